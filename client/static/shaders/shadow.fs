@@ -4,11 +4,14 @@
 // Discards transparent pixels (leaves, vegetation) so they don't cast shadow.
 
 in vec2 fragTexCoord;
+flat in vec3 fragTile;
+flat in float fragRepeat;
 
 uniform sampler2D texture0;  // Atlas texture for alpha test
 
 void main() {
-    float alpha = texture(texture0, fragTexCoord).a;
+    vec2 uv = fragRepeat > 0.5 ? fract(fragTexCoord) : fragTexCoord;
+    float alpha = texture(texture0, fragTile.xy + uv * fragTile.z).a;
     if (alpha < 0.5) {
         discard;
     }
@@ -2,16 +2,28 @@
 
 // Shadow depth pass — vertex shader
 // Renders scene geometry from light's perspective for shadow mapping.
+// Chunk vertices are packed (see voxel.vs).
 
-layout(location = 0) in vec3 vertexPosition;
-layout(location = 1) in vec2 vertexTexCoord;
-layout(location = 4) in vec4 vertexColor;       // For alpha-test on foliage
+layout(location = 0) in vec3 vertexPosition;   // Chunk-local, 1/128 block units
+layout(location = 1) in uvec2 vertexFaceShade; // .x bit 4 = repeat texture across the quad
+layout(location = 2) in vec2 vertexTexCoord;   // Inside the atlas tile, 1/16 tile units
+layout(location = 3) in uint vertexTile;       // For alpha-test on foliage
 
 out vec2 fragTexCoord;
+flat out vec3 fragTile;
+flat out float fragRepeat;
 
 uniform mat4 lightSpaceMatrix;
+uniform vec3 chunkOrigin;
+uniform int atlasTilesPerRow;
 
 void main() {
-    fragTexCoord = vertexTexCoord;
-    gl_Position = lightSpaceMatrix * vec4(vertexPosition, 1.0);
+    float tileSize = 1.0 / float(atlasTilesPerRow);
+    uint perRow = uint(atlasTilesPerRow);
+    fragTile = vec3(vec2(float(vertexTile % perRow), float(vertexTile / perRow)) * tileSize, tileSize);
+    fragRepeat = float((vertexFaceShade.x >> 4u) & 1u);
+    fragTexCoord = vertexTexCoord * (1.0 / 16.0);
+
+    vec3 position = chunkOrigin + vertexPosition * (1.0 / 128.0);
+    gl_Position = lightSpaceMatrix * vec4(position, 1.0);
 }
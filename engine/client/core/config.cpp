@@ -325,6 +325,7 @@ void Config::apply_kv(const std::string& section, const std::string& key, const
         else if (k == "voxel_light_ambient_min") config_.render.voxel_light_ambient_min = parse_float_local(v, config_.render.voxel_light_ambient_min);
         else if (k == "voxel_light_gamma") config_.render.voxel_light_gamma = parse_float_local(v, config_.render.voxel_light_gamma);
         else if (k == "voxel_ao_strength") config_.render.voxel_ao_strength = parse_float_local(v, config_.render.voxel_ao_strength);
+        else if (k == "voxel_greedy_meshing") config_.render.voxel_greedy_meshing = parse_bool(v, config_.render.voxel_greedy_meshing);
         return;
     }
 
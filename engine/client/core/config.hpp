@@ -49,6 +49,8 @@ struct ClientConfig {
         float voxel_light_gamma{1.0f};
 
         float voxel_ao_strength{1.0f};
+
+        bool voxel_greedy_meshing{false};
     } render{};
 
     struct ServerLoggingConfig {
@@ -19,6 +19,10 @@ public:
     ByteWriter() = default;
     explicit ByteWriter(std::size_t reserve) { data_.reserve(reserve); }
 
+    /// Write into existing storage (e.g. a pooled packet buffer), reusing its
+    /// capacity. Previous contents are discarded; take() hands the storage back.
+    explicit ByteWriter(std::vector<std::uint8_t>&& storage) : data_(std::move(storage)) { data_.clear(); }
+
     // --- Primitives ---
     
     void write_u8(std::uint8_t v) {
@@ -26,20 +30,23 @@ public:
     }
     
     void write_u16(std::uint16_t v) {
-        data_.push_back(static_cast<std::uint8_t>(v & 0xFF));
-        data_.push_back(static_cast<std::uint8_t>((v >> 8) & 0xFF));
+        std::uint8_t* p = grow(2);
+        p[0] = static_cast<std::uint8_t>(v & 0xFF);
+        p[1] = static_cast<std::uint8_t>((v >> 8) & 0xFF);
     }
     
     void write_u32(std::uint32_t v) {
-        data_.push_back(static_cast<std::uint8_t>(v & 0xFF));
-        data_.push_back(static_cast<std::uint8_t>((v >> 8) & 0xFF));
-        data_.push_back(static_cast<std::uint8_t>((v >> 16) & 0xFF));
-        data_.push_back(static_cast<std::uint8_t>((v >> 24) & 0xFF));
+        std::uint8_t* p = grow(4);
+        p[0] = static_cast<std::uint8_t>(v & 0xFF);
+        p[1] = static_cast<std::uint8_t>((v >> 8) & 0xFF);
+        p[2] = static_cast<std::uint8_t>((v >> 16) & 0xFF);
+        p[3] = static_cast<std::uint8_t>((v >> 24) & 0xFF);
     }
     
     void write_u64(std::uint64_t v) {
+        std::uint8_t* p = grow(8);
         for (int i = 0; i < 8; ++i) {
-            data_.push_back(static_cast<std::uint8_t>((v >> (i * 8)) & 0xFF));
+            p[i] = static_cast<std::uint8_t>((v >> (i * 8)) & 0xFF);
         }
     }
     
@@ -57,6 +64,15 @@ public:
         write_u8(v ? 1 : 0);
     }
 
+    /// LEB128-style unsigned varint (1-5 bytes).
+    void write_varint(std::uint32_t v) {
+        while (v >= 0x80) {
+            data_.push_back(static_cast<std::uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        data_.push_back(static_cast<std::uint8_t>(v));
+    }
+
     // --- Strings ---
     
     void write_string(std::string_view s) {
@@ -64,13 +80,17 @@ public:
             throw std::runtime_error("String too long for serialization");
         }
         write_u16(static_cast<std::uint16_t>(s.size()));
-        data_.insert(data_.end(), s.begin(), s.end());
+        if (!s.empty()) {
+            std::memcpy(grow(s.size()), s.data(), s.size());
+        }
     }
 
     // --- Raw bytes ---
     
     void write_bytes(std::span<const std::uint8_t> bytes) {
-        data_.insert(data_.end(), bytes.begin(), bytes.end());
+        if (!bytes.empty()) {
+            std::memcpy(grow(bytes.size()), bytes.data(), bytes.size());
+        }
     }
 
     // --- Access ---
@@ -78,8 +98,16 @@ public:
     std::span<const std::uint8_t> data() const { return data_; }
     std::vector<std::uint8_t> take() { return std::move(data_); }
     void clear() { data_.clear(); }
+    void reserve(std::size_t bytes) { data_.reserve(bytes); }
 
 private:
+    // Extend by n bytes and return where they start (one size check per value)
+    std::uint8_t* grow(std::size_t n) {
+        const std::size_t at = data_.size();
+        data_.resize(at + n);
+        return data_.data() + at;
+    }
+
     std::vector<std::uint8_t> data_;
 };
 
@@ -142,6 +170,16 @@ public:
         return read_u8() != 0;
     }
 
+    std::uint32_t read_varint() {
+        std::uint32_t v = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            const std::uint8_t b = read_u8();
+            v |= static_cast<std::uint32_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0) return v;
+        }
+        throw std::runtime_error("ByteReader: varint too long");
+    }
+
     // --- Strings ---
     
     std::string read_string() {
@@ -113,9 +113,9 @@ void ClientEngine::stop() {
 // IClientServices - Networking
 // ============================================================================
 
-void ClientEngine::send(std::span<const std::uint8_t> data) {
+void ClientEngine::send(std::span<const std::uint8_t> data, Delivery delivery) {
     if (transport_ && transport_->is_connected()) {
-        transport_->send(data);
+        transport_->send(data, transport::SendOptions::for_delivery(delivery));
     }
 }
 
@@ -66,7 +66,8 @@ public:
 
     // --- IClientServices implementation ---
     
-    void send(std::span<const std::uint8_t> data) override;
+    void send(std::span<const std::uint8_t> data,
+              Delivery delivery = Delivery::ReliableOrdered) override;
     ConnectionState connection_state() const override;
     std::uint32_t ping_ms() const override;
     float frame_dt() const override { return frameDt_; }
@@ -8,6 +8,7 @@
 
 #include "types.hpp"
 #include "export.hpp"
+#include "packet_pool.hpp"
 
 #include <entt/entt.hpp>
 
@@ -34,6 +35,8 @@ namespace engine::scripting {
 
 namespace engine {
 
+class TickProfiler;
+
 // ============================================================================
 // IEngineServices - Engine provides this to the game server
 // ============================================================================
@@ -45,10 +48,25 @@ public:
     // --- Networking ---
     
     /// Send raw message to a specific player.
-    virtual void send(PlayerId id, std::span<const std::uint8_t> data) = 0;
+    /// Per-tick state that the next tick supersedes should go UnreliableSequenced.
+    virtual void send(PlayerId id, std::span<const std::uint8_t> data,
+                      Delivery delivery = Delivery::ReliableOrdered) = 0;
     
     /// Broadcast raw message to all connected players.
-    virtual void broadcast(std::span<const std::uint8_t> data) = 0;
+    virtual void broadcast(std::span<const std::uint8_t> data,
+                           Delivery delivery = Delivery::ReliableOrdered) = 0;
+    
+    /// Send a pooled packet (see PacketPool). Engines that can pass the buffer
+    /// on to the transport skip the copy made by send().
+    virtual void send_packet(PlayerId id, PacketRef packet,
+                             Delivery delivery = Delivery::ReliableOrdered) {
+        send(id, packet.data(), delivery);
+    }
+    
+    virtual void broadcast_packet(PacketRef packet,
+                                  Delivery delivery = Delivery::ReliableOrdered) {
+        broadcast(packet.data(), delivery);
+    }
     
     /// Disconnect a player.
     virtual void disconnect(PlayerId id) = 0;
@@ -79,6 +97,20 @@ public:
     /// Allows engine-level tools (dev console, hot reload) to interact with scripts
     /// without knowing the concrete game type.
     virtual scripting::ScriptEngineBase* script_engine() { return nullptr; }
+
+    // --- Profiling ---
+    
+    /// Get the tick profiler. Returns nullptr if profiling is disabled.
+    /// Games can register their own phases and time them with ScopedPhaseTimer.
+    virtual TickProfiler* profiler() { return nullptr; }
+
+    // --- Replay ---
+    
+    /// Report the world inputs that, together with the inbound messages,
+    /// fully determine the match (see ReplayWriter). Call once from on_init
+    /// after the map is chosen. Ignored unless the engine is recording.
+    virtual void set_session_info(std::uint32_t seed, std::string_view mapId,
+                                  std::uint32_t mapVersion) {}
 };
 
 // ============================================================================
@@ -126,7 +158,8 @@ public:
     // --- Networking ---
     
     /// Send raw message to the server.
-    virtual void send(std::span<const std::uint8_t> data) = 0;
+    virtual void send(std::span<const std::uint8_t> data,
+                      Delivery delivery = Delivery::ReliableOrdered) = 0;
     
     /// Current connection state.
     virtual ConnectionState connection_state() const = 0;
@@ -0,0 +1,160 @@
+#pragma once
+
+// =============================================================================
+// Lock-free queues - Bounded rings for handing work between threads
+// SpscQueue: one producer, one consumer (cached indices, no CAS).
+// MpscQueue: many producers, one consumer (per-slot sequence numbers).
+// Both are fixed-capacity: try_push fails instead of allocating when full.
+// =============================================================================
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace engine {
+
+namespace detail {
+
+inline constexpr std::size_t kCacheLine = 64;
+
+inline std::size_t queue_capacity(std::size_t requested) {
+    return std::bit_ceil(requested < 2 ? std::size_t{2} : requested);
+}
+
+} // namespace detail
+
+// ============================================================================
+// SpscQueue
+// ============================================================================
+
+template <typename T>
+class SpscQueue {
+public:
+    /// Capacity is rounded up to a power of two.
+    explicit SpscQueue(std::size_t capacity)
+        : capacity_(detail::queue_capacity(capacity))
+        , mask_(capacity_ - 1)
+        , slots_(std::make_unique<T[]>(capacity_))
+    {
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /// Producer thread only. Leaves value untouched and returns false when full.
+    bool try_push(T&& value) {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - headCache_ == capacity_) {
+            headCache_ = head_.load(std::memory_order_acquire);
+            if (tail - headCache_ == capacity_) return false;
+        }
+        slots_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer thread only.
+    bool try_pop(T& out) {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tailCache_) {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            if (head == tailCache_) return false;
+        }
+        out = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Approximate when called while the other side is active.
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<T[]> slots_;
+
+    // Consumer side
+    alignas(detail::kCacheLine) std::atomic<std::size_t> head_{0};
+    std::size_t tailCache_{0};
+
+    // Producer side
+    alignas(detail::kCacheLine) std::atomic<std::size_t> tail_{0};
+    std::size_t headCache_{0};
+};
+
+// ============================================================================
+// MpscQueue
+// ============================================================================
+
+template <typename T>
+class MpscQueue {
+public:
+    /// Capacity is rounded up to a power of two.
+    explicit MpscQueue(std::size_t capacity)
+        : capacity_(detail::queue_capacity(capacity))
+        , mask_(capacity_ - 1)
+        , cells_(std::make_unique<Cell[]>(capacity_))
+    {
+        for (std::size_t i = 0; i < capacity_; ++i) {
+            cells_[i].seq.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    /// Any thread. Leaves value untouched and returns false when full.
+    bool try_push(T&& value) {
+        std::size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & mask_];
+            const std::size_t seq = cell.seq.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(seq - pos);
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Slot still holds an unconsumed value
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Consumer thread only.
+    bool try_pop(T& out) {
+        Cell& cell = cells_[head_ & mask_];
+        if (cell.seq.load(std::memory_order_acquire) != head_ + 1) return false;
+        out = std::move(cell.value);
+        cell.seq.store(head_ + capacity_, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    std::size_t capacity() const { return capacity_; }
+
+private:
+    struct Cell {
+        std::atomic<std::size_t> seq{0};
+        T value{};
+    };
+
+    const std::size_t capacity_;
+    const std::size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(detail::kCacheLine) std::atomic<std::size_t> tail_{0};
+    alignas(detail::kCacheLine) std::size_t head_{0};
+};
+
+} // namespace engine
@@ -0,0 +1,331 @@
+#include "match_host.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace engine {
+
+// ============================================================================
+// MatchHost::Match - Per-match engine services
+// ============================================================================
+
+/// Each match sees its own IEngineServices. Outgoing traffic is buffered in an
+/// outbox while the match ticks on a worker and flushed by the host thread,
+/// since transports are not thread-safe.
+class MatchHost::Match : public IEngineServices {
+public:
+    struct InboundEvent {
+        enum class Kind : std::uint8_t { Connect, Disconnect, Message };
+        Kind kind;
+        PlayerId player;
+        std::vector<std::uint8_t> data;
+    };
+
+    struct OutboundPacket {
+        enum class Kind : std::uint8_t { Send, Broadcast, Disconnect };
+        Kind kind;
+        PlayerId player;
+        PacketRef packet;
+        Delivery delivery{Delivery::ReliableOrdered};
+    };
+
+    Match(MatchHost& host, MatchId id, std::unique_ptr<IGameServer> game)
+        : host_(host), id_(id), game_(std::move(game)),
+          logPrefix_("[match " + std::to_string(id) + "] ") {}
+
+    // --- IEngineServices ---
+
+    void send(PlayerId id, std::span<const std::uint8_t> data,
+              Delivery delivery = Delivery::ReliableOrdered) override {
+        send_packet(id, PacketPool::instance().copy_of(data), delivery);
+    }
+
+    void broadcast(std::span<const std::uint8_t> data,
+                   Delivery delivery = Delivery::ReliableOrdered) override {
+        broadcast_packet(PacketPool::instance().copy_of(data), delivery);
+    }
+
+    void send_packet(PlayerId id, PacketRef packet,
+                     Delivery delivery = Delivery::ReliableOrdered) override {
+        outbox.push_back({OutboundPacket::Kind::Send, id, std::move(packet), delivery});
+    }
+
+    void broadcast_packet(PacketRef packet,
+                          Delivery delivery = Delivery::ReliableOrdered) override {
+        outbox.push_back({OutboundPacket::Kind::Broadcast, kInvalidPlayerId, std::move(packet), delivery});
+    }
+
+    void disconnect(PlayerId id) override {
+        outbox.push_back({OutboundPacket::Kind::Disconnect, id, {}});
+    }
+
+    Tick current_tick() const override { return tick_; }
+    float tick_rate() const override { return host_.config_.tickRate; }
+    float tick_dt() const override { return host_.tickDt_; }
+
+    void log(LogLevel level, std::string_view msg) override {
+        host_.log(level, logPrefix_ + std::string(msg));
+    }
+
+    // --- Host side ---
+
+    void init() { game_->on_init(*this); }
+    void shutdown() { game_->on_shutdown(); }
+
+    /// Deliver queued events then advance one tick. Runs on a worker thread.
+    void tick(float dt) {
+        for (auto& ev : inbox) {
+            switch (ev.kind) {
+                case InboundEvent::Kind::Connect:
+                    game_->on_player_connect(ev.player);
+                    break;
+                case InboundEvent::Kind::Disconnect:
+                    game_->on_player_disconnect(ev.player);
+                    break;
+                case InboundEvent::Kind::Message:
+                    game_->on_player_message(ev.player, ev.data);
+                    break;
+            }
+        }
+        inbox.clear();
+
+        game_->on_tick(dt);
+        ++tick_;
+    }
+
+    MatchId id() const { return id_; }
+
+    // Written by the host thread between ticks, read by the worker during a tick.
+    std::vector<InboundEvent> inbox;
+    // Written by the worker during a tick, drained by the host thread afterwards.
+    std::vector<OutboundPacket> outbox;
+    // Host-thread only.
+    std::vector<transport::ClientId> clients;
+
+private:
+    MatchHost& host_;
+    MatchId id_;
+    std::unique_ptr<IGameServer> game_;
+    std::string logPrefix_;
+    Tick tick_{0};
+};
+
+// ============================================================================
+// Construction
+// ============================================================================
+
+MatchHost::MatchHost()
+    : MatchHost(Config{})
+{
+}
+
+MatchHost::MatchHost(const Config& config)
+    : config_(config)
+    , tickDt_(1.0f / config.tickRate)
+    , scheduler_(config.tickRate, config.scheduling)
+{
+}
+
+MatchHost::~MatchHost() {
+    stop();
+}
+
+void MatchHost::set_transport(std::shared_ptr<transport::IServerTransport> transport) {
+    transport_ = std::move(transport);
+}
+
+MatchHost::MatchId MatchHost::add_match(std::unique_ptr<IGameServer> game) {
+    if (running_ || !game) return kInvalidMatchId;
+    const auto id = static_cast<MatchId>(matches_.size());
+    matches_.push_back(std::make_unique<Match>(*this, id, std::move(game)));
+    return id;
+}
+
+std::size_t MatchHost::player_count(MatchId id) const {
+    return id < matches_.size() ? matches_[id]->clients.size() : 0;
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+void MatchHost::run() {
+    if (!transport_) {
+        log(LogLevel::Error, "No transport set");
+        return;
+    }
+    if (matches_.empty()) {
+        log(LogLevel::Error, "No matches registered");
+        return;
+    }
+
+    running_ = true;
+
+    const std::size_t workers = config_.workerThreads > 0
+        ? config_.workerThreads
+        : ThreadPool::default_worker_count();
+    pool_ = std::make_unique<ThreadPool>(std::min(workers, matches_.size() - 1));
+
+    transport_->onClientConnect = [this](transport::ClientId id) { route_connect(id); };
+    transport_->onClientDisconnect = [this](transport::ClientId id) { route_disconnect(id); };
+    transport_->onReceive = [this](transport::ClientId id, std::span<const std::uint8_t> data) {
+        route_receive(id, data);
+    };
+
+    // Init on the host thread: map loading and script setup are not tick-critical.
+    for (auto& match : matches_) {
+        match->init();
+    }
+    flush_outboxes();
+
+    log(LogLevel::Info, "Match host started: " + std::to_string(matches_.size()) + " matches, " +
+                        std::to_string(pool_->lane_count()) + " lanes at " +
+                        std::to_string(config_.tickRate) + " TPS");
+
+    tick_loop();
+    log(LogLevel::Info, "Tick scheduler: " + scheduler_.report());
+
+    for (auto& match : matches_) {
+        match->shutdown();
+    }
+    flush_outboxes();
+    clientMatch_.clear();
+    pool_.reset();
+    log(LogLevel::Info, "Match host stopped");
+}
+
+void MatchHost::stop() {
+    running_ = false;
+}
+
+void MatchHost::log(LogLevel level, std::string_view msg) {
+    if (!config_.logging) return;
+
+    const char* prefix = "";
+    switch (level) {
+        case LogLevel::Debug:   prefix = "[DEBUG] "; break;
+        case LogLevel::Info:    prefix = "[INFO]  "; break;
+        case LogLevel::Warning: prefix = "[WARN]  "; break;
+        case LogLevel::Error:   prefix = "[ERROR] "; break;
+    }
+
+    // Matches log from worker threads
+    std::lock_guard lock(logMutex_);
+    std::printf("%s%.*s\n", prefix, static_cast<int>(msg.size()), msg.data());
+    std::fflush(stdout);
+}
+
+// ============================================================================
+// Routing (host thread)
+// ============================================================================
+
+MatchHost::MatchId MatchHost::pick_match(transport::ClientId id) const {
+    if (assignCallback_) {
+        return assignCallback_(id);
+    }
+
+    MatchId best = kInvalidMatchId;
+    std::size_t bestCount = config_.maxPlayersPerMatch;
+    for (const auto& match : matches_) {
+        if (match->clients.size() < bestCount) {
+            bestCount = match->clients.size();
+            best = match->id();
+        }
+    }
+    return best;
+}
+
+void MatchHost::route_connect(transport::ClientId id) {
+    const MatchId matchId = pick_match(id);
+    if (matchId >= matches_.size()) {
+        log(LogLevel::Warning, "No match available for client " + std::to_string(id) + ", disconnecting");
+        transport_->disconnect(id);
+        return;
+    }
+
+    auto& match = *matches_[matchId];
+    clientMatch_[id] = matchId;
+    match.clients.push_back(id);
+    match.inbox.push_back({Match::InboundEvent::Kind::Connect, static_cast<PlayerId>(id), {}});
+
+    log(LogLevel::Info, "Client " + std::to_string(id) + " routed to match " + std::to_string(matchId));
+}
+
+void MatchHost::route_disconnect(transport::ClientId id) {
+    auto it = clientMatch_.find(id);
+    if (it == clientMatch_.end()) return;
+
+    auto& match = *matches_[it->second];
+    match.clients.erase(std::remove(match.clients.begin(), match.clients.end(), id), match.clients.end());
+    match.inbox.push_back({Match::InboundEvent::Kind::Disconnect, static_cast<PlayerId>(id), {}});
+    clientMatch_.erase(it);
+}
+
+void MatchHost::route_receive(transport::ClientId id, std::span<const std::uint8_t> data) {
+    auto it = clientMatch_.find(id);
+    if (it == clientMatch_.end()) return;
+
+    matches_[it->second]->inbox.push_back(
+        {Match::InboundEvent::Kind::Message, static_cast<PlayerId>(id), {data.begin(), data.end()}});
+}
+
+void MatchHost::flush_outboxes() {
+    for (auto& matchPtr : matches_) {
+        auto& match = *matchPtr;
+        for (auto& pkt : match.outbox) {
+            switch (pkt.kind) {
+                case Match::OutboundPacket::Kind::Send:
+                    // Drop traffic addressed to clients that left this match.
+                    if (auto it = clientMatch_.find(pkt.player);
+                        it != clientMatch_.end() && it->second == match.id()) {
+                        transport_->send_packet(pkt.player, pkt.packet, transport::SendOptions::for_delivery(pkt.delivery));
+                    }
+                    break;
+                case Match::OutboundPacket::Kind::Broadcast:
+                    // Match-scoped broadcast: only this match's clients, all sharing one buffer.
+                    for (auto client : match.clients) {
+                        transport_->send_packet(client, pkt.packet, transport::SendOptions::for_delivery(pkt.delivery));
+                    }
+                    break;
+                case Match::OutboundPacket::Kind::Disconnect:
+                    if (auto it = clientMatch_.find(pkt.player);
+                        it != clientMatch_.end() && it->second == match.id()) {
+                        transport_->disconnect(pkt.player);
+                    }
+                    break;
+            }
+        }
+        match.outbox.clear();
+    }
+}
+
+// ============================================================================
+// Tick loop
+// ============================================================================
+
+void MatchHost::tick_loop() {
+    const std::function<void(std::size_t, std::size_t)> tickMatch =
+        [this](std::size_t index, std::size_t /*lane*/) {
+            matches_[index]->tick(tickDt_);
+        };
+
+    scheduler_.reset();
+
+    while (running_) {
+        // Usually 1; more when catching up after a stall
+        const std::uint32_t dueTicks = scheduler_.wait_for_ticks();
+
+        for (std::uint32_t i = 0; i < dueTicks && running_; ++i) {
+            // Poll network and route events into match inboxes
+            transport_->poll(0);
+
+            // Tick all matches across the pool (blocks until every match is done)
+            pool_->parallel_for(matches_.size(), tickMatch);
+
+            // Send everything the matches produced this tick
+            flush_outboxes();
+        }
+    }
+}
+
+} // namespace engine
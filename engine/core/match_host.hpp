@@ -0,0 +1,105 @@
+#pragma once
+
+// =============================================================================
+// MatchHost - Multi-match hosting mode for the server engine
+// Runs many independent IGameServer instances in one process. A single
+// transport is polled on the host thread, packets are routed to matches by
+// client id, and match ticks are spread over a fixed worker pool.
+// =============================================================================
+
+#include "game_interface.hpp"
+#include "thread_pool.hpp"
+#include "tick_scheduler.hpp"
+#include "../transport/transport.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace engine {
+
+class RAYFLOW_CORE_API MatchHost {
+public:
+    using MatchId = std::uint32_t;
+    static constexpr MatchId kInvalidMatchId = 0xFFFFFFFFu;
+
+    struct Config {
+        float tickRate = 30.0f;
+        bool logging = true;
+
+        /// Tick pacing and catch-up (see TickScheduler).
+        TickScheduler::Policy scheduling;
+
+        /// Worker threads used to tick matches (0 = hardware threads - 1).
+        std::size_t workerThreads = 0;
+
+        /// Default routing: new clients join the least-populated match below this cap.
+        std::size_t maxPlayersPerMatch = 16;
+    };
+
+    /// Custom routing for new clients. Return kInvalidMatchId to reject.
+    using AssignCallback = std::function<MatchId(transport::ClientId id)>;
+
+    MatchHost();
+    explicit MatchHost(const Config& config);
+    ~MatchHost();
+
+    MatchHost(const MatchHost&) = delete;
+    MatchHost& operator=(const MatchHost&) = delete;
+
+    /// Set the shared transport (must be called before run).
+    void set_transport(std::shared_ptr<transport::IServerTransport> transport);
+
+    /// Register a match (must be called before run). Ownership moves to the host.
+    MatchId add_match(std::unique_ptr<IGameServer> game);
+
+    /// Override the default least-loaded routing policy.
+    void set_assign_callback(AssignCallback callback) { assignCallback_ = std::move(callback); }
+
+    /// Initialize all matches and run the tick loop on the current thread (blocking).
+    void run();
+
+    /// Request shutdown (can be called from another thread).
+    void stop();
+
+    std::size_t match_count() const { return matches_.size(); }
+
+    /// Number of players currently routed to a match (host thread only).
+    std::size_t player_count(MatchId id) const;
+
+    void log(LogLevel level, std::string_view msg);
+
+    /// Pacing counters since start (host thread only while running).
+    const TickScheduler::Stats& scheduler_stats() const { return scheduler_.stats(); }
+
+private:
+    class Match;
+
+    void tick_loop();
+    void route_connect(transport::ClientId id);
+    void route_disconnect(transport::ClientId id);
+    void route_receive(transport::ClientId id, std::span<const std::uint8_t> data);
+    void flush_outboxes();
+    MatchId pick_match(transport::ClientId id) const;
+
+    Config config_;
+    float tickDt_;
+    TickScheduler scheduler_;
+
+    std::shared_ptr<transport::IServerTransport> transport_;
+    std::unique_ptr<ThreadPool> pool_;
+    std::vector<std::unique_ptr<Match>> matches_;
+
+    // Host-thread only: which match each client is routed to.
+    std::unordered_map<transport::ClientId, MatchId> clientMatch_;
+    AssignCallback assignCallback_;
+
+    std::mutex logMutex_;
+    std::atomic<bool> running_{false};
+};
+
+} // namespace engine
@@ -0,0 +1,77 @@
+#include "packet_pool.hpp"
+
+namespace engine {
+
+// ============================================================================
+// PacketRef
+// ============================================================================
+
+void PacketRef::reset() {
+    if (!buf_) return;
+    if (buf_->refs_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        buf_->pool_->recycle(buf_);
+    }
+    buf_ = nullptr;
+}
+
+// ============================================================================
+// PacketPool
+// ============================================================================
+
+PacketPool::~PacketPool() {
+    for (auto* buf : free_) {
+        delete buf;
+    }
+}
+
+PacketPool& PacketPool::instance() {
+    static auto* pool = new PacketPool();
+    return *pool;
+}
+
+PacketRef PacketPool::acquire() {
+    PacketBuffer* buf = nullptr;
+    {
+        std::lock_guard lock(mutex_);
+        if (!free_.empty()) {
+            buf = free_.back();
+            free_.pop_back();
+        }
+    }
+    if (!buf) {
+        buf = new PacketBuffer();
+        buf->pool_ = this;
+    }
+    buf->refs_.store(1, std::memory_order_relaxed);
+    return PacketRef(buf);
+}
+
+PacketRef PacketPool::copy_of(std::span<const std::uint8_t> data) {
+    auto packet = acquire();
+    packet.bytes().assign(data.begin(), data.end());
+    return packet;
+}
+
+std::size_t PacketPool::pooled_count() const {
+    std::lock_guard lock(mutex_);
+    return free_.size();
+}
+
+void PacketPool::recycle(PacketBuffer* buf) {
+    if (buf->bytes_.capacity() > kMaxRetainedCapacity) {
+        std::vector<std::uint8_t>().swap(buf->bytes_);
+    } else {
+        buf->bytes_.clear();
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        if (free_.size() < kMaxPooledBuffers) {
+            free_.push_back(buf);
+            return;
+        }
+    }
+    delete buf;
+}
+
+} // namespace engine
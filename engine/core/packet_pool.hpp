@@ -0,0 +1,103 @@
+#pragma once
+
+// =============================================================================
+// PacketPool - Recycled, refcounted byte buffers for outgoing packets
+// Messages are serialized straight into a pooled buffer that transports hand
+// to the network library without copying. The last PacketRef to go away
+// (usually the library's free callback) returns the buffer to the pool.
+// =============================================================================
+
+#include "export.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace engine {
+
+class PacketPool;
+
+/// Pooled storage node. Only reachable through PacketRef.
+class RAYFLOW_CORE_API PacketBuffer {
+private:
+    friend class PacketPool;
+    friend class PacketRef;
+
+    std::vector<std::uint8_t> bytes_;
+    std::atomic<std::uint32_t> refs_{0};
+    PacketPool* pool_{nullptr};
+};
+
+/// Shared handle to a pooled buffer. Copies share the buffer, which must not
+/// be modified once it has been handed to a transport.
+class RAYFLOW_CORE_API PacketRef {
+public:
+    PacketRef() = default;
+    PacketRef(const PacketRef& other) : buf_(other.buf_) {
+        if (buf_) buf_->refs_.fetch_add(1, std::memory_order_relaxed);
+    }
+    PacketRef(PacketRef&& other) noexcept : buf_(std::exchange(other.buf_, nullptr)) {}
+    PacketRef& operator=(PacketRef other) noexcept {
+        std::swap(buf_, other.buf_);
+        return *this;
+    }
+    ~PacketRef() { reset(); }
+
+    void reset();
+
+    explicit operator bool() const { return buf_ != nullptr; }
+
+    /// Backing storage; its capacity survives recycling.
+    std::vector<std::uint8_t>& bytes() { return buf_->bytes_; }
+    std::span<const std::uint8_t> data() const {
+        return buf_ ? std::span<const std::uint8_t>(buf_->bytes_) : std::span<const std::uint8_t>{};
+    }
+
+    /// Give up this reference as a raw pointer (for C callbacks). Pair with attach().
+    PacketBuffer* detach() { return std::exchange(buf_, nullptr); }
+    static PacketRef attach(PacketBuffer* raw) { return PacketRef(raw); }
+
+private:
+    friend class PacketPool;
+    explicit PacketRef(PacketBuffer* buf) : buf_(buf) {}
+
+    PacketBuffer* buf_{nullptr};
+};
+
+class RAYFLOW_CORE_API PacketPool {
+public:
+    /// Buffers that grew past this are freed instead of pooled (e.g. chunk data).
+    static constexpr std::size_t kMaxRetainedCapacity = 64 * 1024;
+    static constexpr std::size_t kMaxPooledBuffers = 1024;
+
+    PacketPool() = default;
+    ~PacketPool();
+
+    PacketPool(const PacketPool&) = delete;
+    PacketPool& operator=(const PacketPool&) = delete;
+
+    /// Process-wide pool. Never destroyed, so transports torn down during
+    /// static destruction can still release their buffers.
+    static PacketPool& instance();
+
+    /// Empty buffer (size 0, capacity kept from earlier use). Thread-safe.
+    PacketRef acquire();
+
+    /// Pooled buffer holding a copy of data.
+    PacketRef copy_of(std::span<const std::uint8_t> data);
+
+    std::size_t pooled_count() const;
+
+private:
+    friend class PacketRef;
+    void recycle(PacketBuffer* buf);
+
+    mutable std::mutex mutex_;
+    std::vector<PacketBuffer*> free_;
+};
+
+} // namespace engine
@@ -0,0 +1,231 @@
+#include "replay_log.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace engine {
+
+namespace {
+
+constexpr std::array<std::uint8_t, 4> kMagic = {'R', 'F', 'R', 'P'};
+constexpr std::uint32_t kFormatVersion = 1;
+constexpr std::size_t kHeaderSize = 4 + 4 + 4;
+constexpr std::size_t kRecordHeaderSize = 1 + 8 + 4 + 4;
+
+// Records larger than this are treated as corruption, not allocated
+constexpr std::uint32_t kMaxRecordSize = 16 * 1024 * 1024;
+
+} // namespace
+
+// ============================================================================
+// ReplayWriter
+// ============================================================================
+
+ReplayWriter::~ReplayWriter() {
+    if (file_) {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wakeCv_.notify_one();
+    if (writer_.joinable()) writer_.join();
+    if (file_) {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+bool ReplayWriter::open(const std::filesystem::path& path, float tickRate) {
+    if (file_) return false;
+
+    file_ = std::fopen(path.string().c_str(), "wb");
+    if (!file_) return false;
+
+    ByteWriter header(kHeaderSize);
+    header.write_bytes(kMagic);
+    header.write_u32(kFormatVersion);
+    header.write_f32(tickRate);
+    const auto bytes = header.data();
+    if (std::fwrite(bytes.data(), 1, bytes.size(), file_) != bytes.size()) {
+        std::fclose(file_);
+        file_ = nullptr;
+        return false;
+    }
+    bytesWritten_ = bytes.size();
+
+    stopping_ = false;
+    writer_ = std::thread([this]() { writer_loop(); });
+    return true;
+}
+
+void ReplayWriter::close(Tick finalTick) {
+    if (!file_) return;
+
+    append(ReplayRecordKind::End, finalTick, 0, {});
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wakeCv_.notify_one();
+    if (writer_.joinable()) writer_.join();
+
+    std::fclose(file_);
+    file_ = nullptr;
+}
+
+void ReplayWriter::record_session(const ReplaySessionInfo& info) {
+    ByteWriter payload;
+    payload.write_u32(info.seed);
+    payload.write_u32(info.mapVersion);
+    payload.write_string(info.mapId);
+    append(ReplayRecordKind::Session, 0, 0, payload.data());
+}
+
+void ReplayWriter::record_connect(Tick tick, PlayerId id) {
+    append(ReplayRecordKind::Connect, tick, id, {});
+}
+
+void ReplayWriter::record_disconnect(Tick tick, PlayerId id) {
+    append(ReplayRecordKind::Disconnect, tick, id, {});
+}
+
+void ReplayWriter::record_message(Tick tick, PlayerId id, std::span<const std::uint8_t> data) {
+    append(ReplayRecordKind::Message, tick, id, data);
+}
+
+std::uint64_t ReplayWriter::bytes_written() const {
+    std::lock_guard lock(mutex_);
+    return bytesWritten_;
+}
+
+void ReplayWriter::append(ReplayRecordKind kind, Tick tick, PlayerId id,
+                          std::span<const std::uint8_t> data) {
+    if (!file_) return;
+
+    bool wake = false;
+    {
+        std::lock_guard lock(mutex_);
+        pending_.write_u8(static_cast<std::uint8_t>(kind));
+        pending_.write_u64(tick);
+        pending_.write_u32(id);
+        pending_.write_u32(static_cast<std::uint32_t>(data.size()));
+        pending_.write_bytes(data);
+        wake = pending_.data().size() >= kFlushThreshold;
+    }
+    if (wake) wakeCv_.notify_one();
+}
+
+void ReplayWriter::writer_loop() {
+    // Two buffers trade places: the tick thread fills one while this thread
+    // writes the other, so steady-state recording does not allocate.
+    std::vector<std::uint8_t> spare;
+    spare.reserve(kFlushThreshold);
+
+    for (;;) {
+        std::vector<std::uint8_t> batch;
+        bool stop = false;
+        {
+            std::unique_lock lock(mutex_);
+            wakeCv_.wait_for(lock, kFlushInterval, [this]() {
+                return stopping_ || pending_.data().size() >= kFlushThreshold;
+            });
+            batch = pending_.take();
+            pending_ = ByteWriter(std::move(spare));
+            stop = stopping_;
+        }
+
+        if (!batch.empty()) {
+            const std::size_t n = std::fwrite(batch.data(), 1, batch.size(), file_);
+            std::fflush(file_);
+            std::lock_guard lock(mutex_);
+            bytesWritten_ += n;
+        }
+
+        batch.clear();
+        spare = std::move(batch);
+        if (stop) break;
+    }
+}
+
+// ============================================================================
+// ReplayReader
+// ============================================================================
+
+ReplayReader::~ReplayReader() {
+    if (file_) std::fclose(file_);
+}
+
+bool ReplayReader::open(const std::filesystem::path& path, std::string* error) {
+    auto fail = [&](const char* msg) {
+        if (error) *error = msg;
+        if (file_) {
+            std::fclose(file_);
+            file_ = nullptr;
+        }
+        return false;
+    };
+
+    if (file_) return fail("reader already open");
+    file_ = std::fopen(path.string().c_str(), "rb");
+    if (!file_) return fail("cannot open file");
+
+    std::array<std::uint8_t, kHeaderSize> header{};
+    if (std::fread(header.data(), 1, header.size(), file_) != header.size()) {
+        return fail("file too short for header");
+    }
+    if (std::memcmp(header.data(), kMagic.data(), kMagic.size()) != 0) {
+        return fail("not a replay log");
+    }
+
+    ByteReader r(std::span<const std::uint8_t>(header).subspan(kMagic.size()));
+    if (r.read_u32() != kFormatVersion) return fail("unsupported replay format version");
+    tickRate_ = r.read_f32();
+    if (!(tickRate_ > 0.0f)) return fail("invalid tick rate");
+
+    truncated_ = false;
+    return true;
+}
+
+bool ReplayReader::next(ReplayRecord& out) {
+    if (!file_) return false;
+
+    std::array<std::uint8_t, kRecordHeaderSize> header{};
+    const std::size_t got = std::fread(header.data(), 1, header.size(), file_);
+    if (got != header.size()) {
+        truncated_ = got != 0;
+        return false;
+    }
+
+    ByteReader r(header);
+    const std::uint8_t kind = r.read_u8();
+    out.tick = r.read_u64();
+    out.player = r.read_u32();
+    const std::uint32_t size = r.read_u32();
+    if (kind < static_cast<std::uint8_t>(ReplayRecordKind::Session) ||
+        kind > static_cast<std::uint8_t>(ReplayRecordKind::End) ||
+        size > kMaxRecordSize) {
+        truncated_ = true;
+        return false;
+    }
+    out.kind = static_cast<ReplayRecordKind>(kind);
+
+    out.data.resize(size);
+    if (size > 0 && std::fread(out.data.data(), 1, size, file_) != size) {
+        truncated_ = true;
+        return false;
+    }
+    return true;
+}
+
+bool ReplayReader::parse_session(std::span<const std::uint8_t> data, ReplaySessionInfo& out) {
+    try {
+        ByteReader r(data);
+        out.seed = r.read_u32();
+        out.mapVersion = r.read_u32();
+        out.mapId = r.read_string();
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+} // namespace engine
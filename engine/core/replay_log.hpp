@@ -0,0 +1,141 @@
+#pragma once
+
+// =============================================================================
+// ReplayLog - Append-only binary log of everything an IGameServer receives
+// The session info (seed, map id/version) plus every connect, disconnect and
+// message with the tick it arrived on is the complete input of a match, so
+// feeding it back tick by tick reproduces the match without a network.
+// =============================================================================
+
+#include "export.hpp"
+#include "byte_buffer.hpp"
+#include "types.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace engine {
+
+// ============================================================================
+// File format (little-endian)
+// ============================================================================
+//
+//   header:  "RFRP" | u32 formatVersion | f32 tickRate
+//   record:  u8 kind | u64 tick | u32 playerId | u32 size | size bytes
+//
+// Session payload: u32 seed | u32 mapVersion | string mapId (u16 length).
+// Records are in arrival order; a log cut short by a crash simply ends early.
+
+enum class ReplayRecordKind : std::uint8_t {
+    Session    = 1,  // Game-reported world inputs (seed, map)
+    Connect    = 2,
+    Disconnect = 3,
+    Message    = 4,  // Payload is the raw inbound message
+    End        = 5,  // Clean shutdown; tick = number of ticks run
+};
+
+struct ReplaySessionInfo {
+    std::uint32_t seed{0};
+    std::string mapId;           // Empty = procedural world, no map template
+    std::uint32_t mapVersion{0};
+};
+
+struct ReplayRecord {
+    ReplayRecordKind kind{ReplayRecordKind::Message};
+    Tick tick{0};
+    PlayerId player{0};
+    std::vector<std::uint8_t> data;
+};
+
+// ============================================================================
+// ReplayWriter - Buffered log writer with a background flush thread
+// ============================================================================
+
+/// Recording only appends to an in-memory buffer under a short lock; a
+/// writer thread swaps that buffer out and does the file I/O, so the tick
+/// thread never blocks on disk. Recording is single-producer (tick thread).
+class RAYFLOW_CORE_API ReplayWriter {
+public:
+    ReplayWriter() = default;
+    ~ReplayWriter();
+
+    ReplayWriter(const ReplayWriter&) = delete;
+    ReplayWriter& operator=(const ReplayWriter&) = delete;
+
+    /// Create the file, write the header and start the writer thread.
+    bool open(const std::filesystem::path& path, float tickRate);
+
+    /// Write the End record, flush everything and stop the writer thread.
+    void close(Tick finalTick);
+
+    bool is_open() const { return file_ != nullptr; }
+
+    void record_session(const ReplaySessionInfo& info);
+    void record_connect(Tick tick, PlayerId id);
+    void record_disconnect(Tick tick, PlayerId id);
+    void record_message(Tick tick, PlayerId id, std::span<const std::uint8_t> data);
+
+    /// Bytes handed to the file so far (writer thread view).
+    std::uint64_t bytes_written() const;
+
+private:
+    void append(ReplayRecordKind kind, Tick tick, PlayerId id, std::span<const std::uint8_t> data);
+    void writer_loop();
+
+    // Wake the writer early once this much is pending; otherwise it flushes
+    // on its interval so a crash loses at most about a second of input.
+    static constexpr std::size_t kFlushThreshold = 64 * 1024;
+    static constexpr auto kFlushInterval = std::chrono::milliseconds(1000);
+
+    std::FILE* file_{nullptr};
+    std::thread writer_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable wakeCv_;
+    ByteWriter pending_{kFlushThreshold};  // Filled by the tick thread
+    std::uint64_t bytesWritten_{0};
+    bool stopping_{false};
+};
+
+// ============================================================================
+// ReplayReader - Sequential reader for a replay log
+// ============================================================================
+
+class RAYFLOW_CORE_API ReplayReader {
+public:
+    ReplayReader() = default;
+    ~ReplayReader();
+
+    ReplayReader(const ReplayReader&) = delete;
+    ReplayReader& operator=(const ReplayReader&) = delete;
+
+    /// Open the file and validate the header.
+    bool open(const std::filesystem::path& path, std::string* error = nullptr);
+
+    /// Read the next record. False at end of file or on a truncated record.
+    bool next(ReplayRecord& out);
+
+    float tick_rate() const { return tickRate_; }
+
+    /// True if the last next() stopped on a partial record (crashed writer).
+    bool truncated() const { return truncated_; }
+
+    /// Decode a Session record payload.
+    static bool parse_session(std::span<const std::uint8_t> data, ReplaySessionInfo& out);
+
+private:
+    std::FILE* file_{nullptr};
+    float tickRate_{0.0f};
+    bool truncated_{false};
+};
+
+} // namespace engine
@@ -2,7 +2,6 @@
 
 #include <cstdio>
 #include <string>
-#include <thread>
 
 namespace engine {
 
@@ -14,7 +13,13 @@ ServerEngine::ServerEngine()
 ServerEngine::ServerEngine(const Config& config)
     : config_(config)
     , tickDt_(1.0f / config.tickRate)
+    , scheduler_(config.tickRate, config.scheduling)
 {
+    if (config_.profiling) {
+        profiler_ = std::make_unique<TickProfiler>(config_.tickRate);
+        pollPhase_ = profiler_->register_phase("engine.poll");
+        gameTickPhase_ = profiler_->register_phase("engine.game_tick");
+    }
 }
 
 ServerEngine::~ServerEngine() {
@@ -34,18 +39,32 @@ void ServerEngine::run(IGameServer& game) {
     game_ = &game;
     running_ = true;
     
-    // Setup transport callbacks
+    if (!config_.replayPath.empty()) {
+        replay_ = std::make_unique<ReplayWriter>();
+        if (replay_->open(config_.replayPath, config_.tickRate)) {
+            log(LogLevel::Info, "Recording replay to " + config_.replayPath);
+        } else {
+            log(LogLevel::Warning, "Failed to open replay log " + config_.replayPath);
+            replay_.reset();
+        }
+    }
+    
+    // Setup transport callbacks. Everything is recorded before the game sees
+    // it, stamped with the tick that is about to run.
     transport_->onClientConnect = [this, &game](transport::ClientId id) {
         log(LogLevel::Info, "Player connected: " + std::to_string(id));
+        if (replay_) replay_->record_connect(tick_, static_cast<PlayerId>(id));
         game.on_player_connect(static_cast<PlayerId>(id));
     };
     
     transport_->onClientDisconnect = [this, &game](transport::ClientId id) {
         log(LogLevel::Info, "Player disconnected: " + std::to_string(id));
+        if (replay_) replay_->record_disconnect(tick_, static_cast<PlayerId>(id));
         game.on_player_disconnect(static_cast<PlayerId>(id));
     };
     
     transport_->onReceive = [this, &game](transport::ClientId id, std::span<const std::uint8_t> data) {
+        if (replay_) replay_->record_message(tick_, static_cast<PlayerId>(id), data);
         game.on_player_message(static_cast<PlayerId>(id), data);
     };
     
@@ -56,8 +75,24 @@ void ServerEngine::run(IGameServer& game) {
     // Run tick loop
     tick_loop(game);
     
+    // Final profile dump covers the tail since the last interval; without
+    // profiling the scheduler stats cover the whole run
+    if (profiler_) {
+        dump_profile();
+    } else {
+        log(LogLevel::Info, "Tick scheduler: " + scheduler_.report());
+    }
+    
     // Shutdown
     game.on_shutdown();
+    
+    if (replay_) {
+        replay_->close(tick_);
+        log(LogLevel::Info, "Replay log closed after " + std::to_string(tick_) + " ticks (" +
+            std::to_string(replay_->bytes_written()) + " bytes)");
+        replay_.reset();
+    }
+    
     log(LogLevel::Info, "Server stopped");
     game_ = nullptr;
 }
@@ -66,15 +101,29 @@ void ServerEngine::stop() {
     running_ = false;
 }
 
-void ServerEngine::send(PlayerId id, std::span<const std::uint8_t> data) {
+void ServerEngine::send(PlayerId id, std::span<const std::uint8_t> data, Delivery delivery) {
+    if (transport_) {
+        transport_->send(static_cast<transport::ClientId>(id), data,
+                         transport::SendOptions::for_delivery(delivery));
+    }
+}
+
+void ServerEngine::broadcast(std::span<const std::uint8_t> data, Delivery delivery) {
+    if (transport_) {
+        transport_->broadcast(data, transport::SendOptions::for_delivery(delivery));
+    }
+}
+
+void ServerEngine::send_packet(PlayerId id, PacketRef packet, Delivery delivery) {
     if (transport_) {
-        transport_->send(static_cast<transport::ClientId>(id), data);
+        transport_->send_packet(static_cast<transport::ClientId>(id), packet,
+                                transport::SendOptions::for_delivery(delivery));
     }
 }
 
-void ServerEngine::broadcast(std::span<const std::uint8_t> data) {
+void ServerEngine::broadcast_packet(PacketRef packet, Delivery delivery) {
     if (transport_) {
-        transport_->broadcast(data);
+        transport_->broadcast_packet(packet, transport::SendOptions::for_delivery(delivery));
     }
 }
 
@@ -84,6 +133,13 @@ void ServerEngine::disconnect(PlayerId id) {
     }
 }
 
+void ServerEngine::set_session_info(std::uint32_t seed, std::string_view mapId,
+                                    std::uint32_t mapVersion) {
+    if (replay_) {
+        replay_->record_session(ReplaySessionInfo{seed, std::string(mapId), mapVersion});
+    }
+}
+
 void ServerEngine::log(LogLevel level, std::string_view msg) {
     if (!config_.logging) return;
     
@@ -100,33 +156,64 @@ void ServerEngine::log(LogLevel level, std::string_view msg) {
     std::fflush(stdout);
 }
 
+void ServerEngine::dump_profile() {
+    if (!profiler_ || profiler_->tick_count() == 0) return;
+    
+    if (!config_.profileDumpPath.empty()) {
+        if (!profiler_->dump_to_file(config_.profileDumpPath)) {
+            log(LogLevel::Warning, "Failed to write tick profile to " + config_.profileDumpPath);
+        }
+    } else {
+        log(LogLevel::Info, profiler_->report());
+    }
+    // Same interval as the phase timings above
+    log(LogLevel::Info, "Tick scheduler: " + scheduler_.report());
+    scheduler_.reset_stats();
+    profiler_->reset();
+}
+
 void ServerEngine::tick_loop(IGameServer& game) {
-    using Clock = std::chrono::steady_clock;
+    using Clock = TickScheduler::Clock;
     using Duration = std::chrono::duration<double>;
     
-    const Duration tickDuration(tickDt_);
-    auto nextTick = Clock::now();
+    const auto dumpInterval = std::chrono::duration_cast<Clock::duration>(
+        Duration(config_.profileDumpIntervalSec));
+    auto nextDump = Clock::now() + dumpInterval;
+    
+    scheduler_.reset();
     
     while (running_) {
-        auto now = Clock::now();
+        // Usually 1; more when catching up after a stall
+        const std::uint32_t dueTicks = scheduler_.wait_for_ticks();
         
-        if (now >= nextTick) {
-            // Poll network
-            transport_->poll(0);
+        for (std::uint32_t i = 0; i < dueTicks && running_; ++i) {
+            const auto tickStart = Clock::now();
+            TickProfiler* prof = profiler_.get();
+            
+            // Poll network. With a ThreadedServerTransport this only drains
+            // what its I/O thread received; all game callbacks run here.
+            {
+                ScopedPhaseTimer timer(prof, pollPhase_);
+                transport_->poll(0);
+            }
             
             // Game tick
-            game.on_tick(tickDt_);
+            {
+                ScopedPhaseTimer timer(prof, gameTickPhase_);
+                game.on_tick(tickDt_);
+            }
             ++tick_;
             
-            nextTick += std::chrono::duration_cast<Clock::duration>(tickDuration);
-            
-            // If we're behind, catch up (but don't spiral)
-            if (now > nextTick) {
-                nextTick = now + std::chrono::duration_cast<Clock::duration>(tickDuration);
+            if (prof) {
+                const auto tickEnd = Clock::now();
+                prof->end_tick(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(tickEnd - tickStart).count()));
+                
+                if (config_.profileDumpIntervalSec > 0.0f && tickEnd >= nextDump) {
+                    dump_profile();
+                    nextDump = tickEnd + dumpInterval;
+                }
             }
-        } else {
-            // Sleep until next tick
-            std::this_thread::sleep_until(nextTick);
         }
     }
 }
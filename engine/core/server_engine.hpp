@@ -6,12 +6,16 @@
 // =============================================================================
 
 #include "game_interface.hpp"
+#include "replay_log.hpp"
+#include "tick_profiler.hpp"
+#include "tick_scheduler.hpp"
 #include "../transport/transport.hpp"
 
 #include <atomic>
 #include <chrono>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <thread>
 
 namespace engine {
@@ -25,6 +29,17 @@ public:
     struct Config {
         float tickRate = 30.0f;
         bool logging = true;
+        
+        // Tick pacing and catch-up (see TickScheduler)
+        TickScheduler::Policy scheduling;
+        
+        // Tick profiler (per-phase histograms, periodic dump)
+        bool profiling = false;
+        float profileDumpIntervalSec = 10.0f;
+        std::string profileDumpPath;  // Empty = dump to log
+        
+        // Replay log of every inbound event (empty = not recording)
+        std::string replayPath;
     };
 
     ServerEngine();
@@ -43,8 +58,14 @@ public:
 
     // --- IEngineServices implementation ---
     
-    void send(PlayerId id, std::span<const std::uint8_t> data) override;
-    void broadcast(std::span<const std::uint8_t> data) override;
+    void send(PlayerId id, std::span<const std::uint8_t> data,
+              Delivery delivery = Delivery::ReliableOrdered) override;
+    void broadcast(std::span<const std::uint8_t> data,
+                   Delivery delivery = Delivery::ReliableOrdered) override;
+    void send_packet(PlayerId id, PacketRef packet,
+                     Delivery delivery = Delivery::ReliableOrdered) override;
+    void broadcast_packet(PacketRef packet,
+                          Delivery delivery = Delivery::ReliableOrdered) override;
     void disconnect(PlayerId id) override;
     
     Tick current_tick() const override { return tick_; }
@@ -52,16 +73,32 @@ public:
     float tick_dt() const override { return tickDt_; }
     
     void log(LogLevel level, std::string_view msg) override;
+    
+    TickProfiler* profiler() override { return profiler_.get(); }
+    
+    void set_session_info(std::uint32_t seed, std::string_view mapId,
+                          std::uint32_t mapVersion) override;
+    
+    /// Pacing counters since start, or since the last profile dump when
+    /// profiling is on (tick thread only while running).
+    const TickScheduler::Stats& scheduler_stats() const { return scheduler_.stats(); }
 
 private:
     void tick_loop(IGameServer& game);
+    void dump_profile();
 
     Config config_;
     float tickDt_;
+    TickScheduler scheduler_;
     
     std::shared_ptr<transport::IServerTransport> transport_;
     IGameServer* game_{nullptr};
     
+    std::unique_ptr<TickProfiler> profiler_;
+    std::unique_ptr<ReplayWriter> replay_;
+    TickProfiler::PhaseId pollPhase_{TickProfiler::kInvalidPhase};
+    TickProfiler::PhaseId gameTickPhase_{TickProfiler::kInvalidPhase};
+    
     std::atomic<bool> running_{false};
     Tick tick_{0};
 };
@@ -0,0 +1,77 @@
+#include "spatial_grid.hpp"
+
+#include <algorithm>
+
+namespace engine {
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : cellSize_(std::max(cellSize, 0.01f))
+    , invCellSize_(1.0f / cellSize_)
+{
+}
+
+void SpatialGrid::insert(Id id, float x, float y, float z) {
+    if (contains(id)) {
+        move(id, x, y, z);
+        return;
+    }
+
+    const CellKey key = cell_key(cell_coord(x), cell_coord(z));
+    auto& cell = cells_[key];
+    locations_[id] = Location{key, static_cast<std::uint32_t>(cell.size())};
+    cell.push_back(Entry{id, x, y, z});
+}
+
+bool SpatialGrid::remove(Id id) {
+    auto it = locations_.find(id);
+    if (it == locations_.end()) return false;
+
+    erase_entry(it->second);
+    locations_.erase(it);
+    return true;
+}
+
+void SpatialGrid::move(Id id, float x, float y, float z) {
+    auto it = locations_.find(id);
+    if (it == locations_.end()) {
+        insert(id, x, y, z);
+        return;
+    }
+
+    Location& loc = it->second;
+    const CellKey key = cell_key(cell_coord(x), cell_coord(z));
+    if (key == loc.cell) {
+        Entry& e = cells_[key][loc.index];
+        e.x = x;
+        e.y = y;
+        e.z = z;
+        return;
+    }
+
+    erase_entry(loc);
+    auto& cell = cells_[key];
+    loc = Location{key, static_cast<std::uint32_t>(cell.size())};
+    cell.push_back(Entry{id, x, y, z});
+}
+
+void SpatialGrid::clear() {
+    cells_.clear();
+    locations_.clear();
+}
+
+void SpatialGrid::query_radius(float x, float y, float z, float radius, std::vector<Id>& out) const {
+    out.clear();
+    query_radius(x, y, z, radius, [&out](Id id, float, float, float) { out.push_back(id); });
+}
+
+void SpatialGrid::erase_entry(const Location& loc) {
+    // Swap-and-pop; the entry moved into the hole needs its index fixed.
+    auto& cell = cells_[loc.cell];
+    if (loc.index + 1 != cell.size()) {
+        cell[loc.index] = cell.back();
+        locations_[cell[loc.index].id].index = loc.index;
+    }
+    cell.pop_back();
+}
+
+} // namespace engine
@@ -0,0 +1,104 @@
+#pragma once
+
+// =============================================================================
+// SpatialGrid - Uniform grid over the XZ plane for proximity queries
+// Points live in square column cells keyed by (cx, cz); a radius query only
+// visits the cells its bounding square overlaps and then applies the exact
+// 3D distance test. Ids are caller-chosen (entity or player ids).
+// =============================================================================
+
+#include "export.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace engine {
+
+class RAYFLOW_CORE_API SpatialGrid {
+public:
+    using Id = std::uint32_t;
+
+    /// Cell size should be on the order of the typical query radius.
+    explicit SpatialGrid(float cellSize = 4.0f);
+
+    /// Add a point. Inserting an id that is already present moves it.
+    void insert(Id id, float x, float y, float z);
+
+    /// Returns false if the id was not in the grid.
+    bool remove(Id id);
+
+    /// Update a point's position. Staying within a cell only rewrites the
+    /// stored position; unknown ids are inserted.
+    void move(Id id, float x, float y, float z);
+
+    bool contains(Id id) const { return locations_.count(id) != 0; }
+    std::size_t size() const { return locations_.size(); }
+    float cell_size() const { return cellSize_; }
+
+    void clear();
+
+    /// Call fn(id, x, y, z) for every point within radius of (x, y, z).
+    /// fn must not modify the grid; collect ids first to remove them.
+    template <typename Fn>
+    void query_radius(float x, float y, float z, float radius, Fn&& fn) const {
+        const float r2 = radius * radius;
+        const int minCx = cell_coord(x - radius);
+        const int maxCx = cell_coord(x + radius);
+        const int minCz = cell_coord(z - radius);
+        const int maxCz = cell_coord(z + radius);
+
+        for (int cz = minCz; cz <= maxCz; ++cz) {
+            for (int cx = minCx; cx <= maxCx; ++cx) {
+                auto it = cells_.find(cell_key(cx, cz));
+                if (it == cells_.end()) continue;
+                for (const Entry& e : it->second) {
+                    const float dx = e.x - x;
+                    const float dy = e.y - y;
+                    const float dz = e.z - z;
+                    if (dx * dx + dy * dy + dz * dz <= r2) {
+                        fn(e.id, e.x, e.y, e.z);
+                    }
+                }
+            }
+        }
+    }
+
+    /// Replace out with the ids within radius (unordered).
+    void query_radius(float x, float y, float z, float radius, std::vector<Id>& out) const;
+
+private:
+    using CellKey = std::uint64_t;
+
+    struct Entry {
+        Id id;
+        float x, y, z;
+    };
+
+    struct Location {
+        CellKey cell;
+        std::uint32_t index;  // position in the cell's entry list
+    };
+
+    int cell_coord(float v) const {
+        return static_cast<int>(std::floor(v * invCellSize_));
+    }
+
+    static CellKey cell_key(int cx, int cz) {
+        return (static_cast<CellKey>(static_cast<std::uint32_t>(cx)) << 32) |
+               static_cast<std::uint32_t>(cz);
+    }
+
+    void erase_entry(const Location& loc);
+
+    float cellSize_;
+    float invCellSize_;
+
+    // Emptied cells are kept: generators and bases refill the same few cells.
+    std::unordered_map<CellKey, std::vector<Entry>> cells_;
+    std::unordered_map<Id, Location> locations_;
+};
+
+} // namespace engine
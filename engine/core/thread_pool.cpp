@@ -0,0 +1,89 @@
+#include "thread_pool.hpp"
+
+#include <algorithm>
+
+namespace engine {
+
+ThreadPool::ThreadPool(std::size_t workerCount) {
+    workers_.reserve(workerCount);
+    for (std::size_t i = 0; i < workerCount; ++i) {
+        // Lane 0 is the calling thread; workers take lanes 1..N.
+        workers_.emplace_back([this, lane = i + 1]() { worker_loop(lane); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wakeCv_.notify_all();
+    for (auto& t : workers_) {
+        if (t.joinable()) t.join();
+    }
+}
+
+std::size_t ThreadPool::default_worker_count() {
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw > 1 ? static_cast<std::size_t>(hw - 1) : 0;
+}
+
+void ThreadPool::run_lane(std::size_t lane) {
+    const auto& fn = *job_;
+    for (;;) {
+        const std::size_t index = nextIndex_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= jobCount_) break;
+        fn(index, lane);
+    }
+}
+
+void ThreadPool::parallel_for(std::size_t count,
+                              const std::function<void(std::size_t, std::size_t)>& fn) {
+    if (count == 0) return;
+
+    // Inline path: no workers, or not worth waking them for a single item.
+    if (workers_.empty() || count == 1) {
+        for (std::size_t i = 0; i < count; ++i) fn(i, 0);
+        return;
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        job_ = &fn;
+        jobCount_ = count;
+        nextIndex_.store(0, std::memory_order_relaxed);
+        activeWorkers_ = workers_.size();
+        ++generation_;
+    }
+    wakeCv_.notify_all();
+
+    run_lane(0);
+
+    // Workers still hold a pointer to fn until they check out.
+    std::unique_lock lock(mutex_);
+    doneCv_.wait(lock, [this]() { return activeWorkers_ == 0; });
+    job_ = nullptr;
+}
+
+void ThreadPool::worker_loop(std::size_t lane) {
+    std::uint64_t seenGeneration = 0;
+    for (;;) {
+        {
+            std::unique_lock lock(mutex_);
+            wakeCv_.wait(lock, [&]() { return stopping_ || generation_ != seenGeneration; });
+            if (stopping_) return;
+            seenGeneration = generation_;
+        }
+
+        run_lane(lane);
+
+        {
+            std::lock_guard lock(mutex_);
+            if (--activeWorkers_ == 0) {
+                doneCv_.notify_one();
+            }
+        }
+    }
+}
+
+} // namespace engine
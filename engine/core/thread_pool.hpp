@@ -0,0 +1,63 @@
+#pragma once
+
+// =============================================================================
+// ThreadPool - Fixed worker pool for fork/join style parallel loops
+// The calling thread participates, so a pool of N workers runs N+1 lanes.
+// =============================================================================
+
+#include "export.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace engine {
+
+class RAYFLOW_CORE_API ThreadPool {
+public:
+    /// Create a pool with the given number of worker threads.
+    /// 0 workers is valid: parallel_for then runs inline on the caller.
+    explicit ThreadPool(std::size_t workerCount);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    std::size_t worker_count() const { return workers_.size(); }
+
+    /// Number of lanes a parallel_for runs on (workers + calling thread).
+    std::size_t lane_count() const { return workers_.size() + 1; }
+
+    /// Run fn(index, lane) for every index in [0, count) and block until all
+    /// calls have returned. lane is in [0, lane_count()) and is stable for
+    /// the duration of one call, so it can index per-thread scratch buffers.
+    /// Not reentrant: call from one thread at a time.
+    void parallel_for(std::size_t count, const std::function<void(std::size_t index, std::size_t lane)>& fn);
+
+    /// Suggested worker count for this machine (hardware threads - 1).
+    static std::size_t default_worker_count();
+
+private:
+    void worker_loop(std::size_t lane);
+    void run_lane(std::size_t lane);
+
+    std::vector<std::thread> workers_;
+
+    std::mutex mutex_;
+    std::condition_variable wakeCv_;
+    std::condition_variable doneCv_;
+
+    const std::function<void(std::size_t, std::size_t)>* job_{nullptr};
+    std::size_t jobCount_{0};
+    std::atomic<std::size_t> nextIndex_{0};
+    std::size_t activeWorkers_{0};
+    std::uint64_t generation_{0};
+    bool stopping_{false};
+};
+
+} // namespace engine
@@ -0,0 +1,160 @@
+#include "tick_profiler.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <fstream>
+
+namespace engine {
+
+// ============================================================================
+// LatencyHistogram
+// ============================================================================
+
+int LatencyHistogram::bucket_index(std::uint64_t us) {
+    if (us < static_cast<std::uint64_t>(kSubBuckets)) {
+        return static_cast<int>(us);
+    }
+    // Top kSubBucketBits+1 bits select the bucket; the rest is the magnitude.
+    const int msb = static_cast<int>(std::bit_width(us)) - 1;
+    const int shift = msb - kSubBucketBits;
+    const int sub = static_cast<int>(us >> shift) - kSubBuckets;
+    const int index = (shift + 1) * kSubBuckets + sub;
+    return std::min(index, kBucketCount - 1);
+}
+
+std::uint64_t LatencyHistogram::bucket_upper_bound(int index) {
+    const int magnitude = index / kSubBuckets;
+    const int sub = index % kSubBuckets;
+    if (magnitude == 0) {
+        return static_cast<std::uint64_t>(sub);
+    }
+    const int shift = magnitude - 1;
+    return ((static_cast<std::uint64_t>(kSubBuckets + sub + 1)) << shift) - 1;
+}
+
+void LatencyHistogram::record(std::uint64_t us) {
+    ++buckets_[static_cast<std::size_t>(bucket_index(us))];
+    ++count_;
+    sum_ += us;
+    min_ = std::min(min_, us);
+    max_ = std::max(max_, us);
+}
+
+void LatencyHistogram::reset() {
+    buckets_.fill(0);
+    count_ = 0;
+    sum_ = 0;
+    min_ = ~0ull;
+    max_ = 0;
+}
+
+std::uint64_t LatencyHistogram::percentile(double p) const {
+    if (count_ == 0) return 0;
+
+    p = std::clamp(p, 0.0, 100.0);
+    auto target = static_cast<std::uint64_t>(p / 100.0 * static_cast<double>(count_) + 0.5);
+    target = std::clamp<std::uint64_t>(target, 1, count_);
+
+    std::uint64_t seen = 0;
+    for (int i = 0; i < kBucketCount; ++i) {
+        seen += buckets_[static_cast<std::size_t>(i)];
+        if (seen >= target) {
+            return std::min(bucket_upper_bound(i), max_);
+        }
+    }
+    return max_;
+}
+
+// ============================================================================
+// TickProfiler
+// ============================================================================
+
+TickProfiler::TickProfiler(float tickRate)
+    : budgetUs_(tickRate > 0.0f ? static_cast<std::uint64_t>(1'000'000.0f / tickRate) : 0)
+{
+}
+
+TickProfiler::PhaseId TickProfiler::register_phase(std::string_view name) {
+    for (std::size_t i = 0; i < phases_.size(); ++i) {
+        if (phases_[i].name == name) {
+            return static_cast<PhaseId>(i);
+        }
+    }
+    if (phases_.size() >= kInvalidPhase) {
+        return kInvalidPhase;
+    }
+    phases_.push_back(PhaseStats{std::string(name), {}, 0});
+    return static_cast<PhaseId>(phases_.size() - 1);
+}
+
+void TickProfiler::record(PhaseId id, std::uint64_t ns) {
+    if (id >= phases_.size()) return;
+
+    auto& phase = phases_[id];
+    const std::uint64_t us = ns / 1000;
+    phase.histogram.record(us);
+    if (budgetUs_ != 0 && us > budgetUs_) {
+        ++phase.overruns;
+    }
+}
+
+void TickProfiler::end_tick(std::uint64_t tickNs) {
+    const std::uint64_t us = tickNs / 1000;
+    tickHistogram_.record(us);
+    if (budgetUs_ != 0 && us > budgetUs_) {
+        ++tickOverruns_;
+    }
+}
+
+std::string TickProfiler::report() const {
+    std::string out;
+    char line[256];
+
+    std::snprintf(line, sizeof(line),
+                  "Tick profile: %llu ticks, budget %llu us, %llu overruns\n",
+                  static_cast<unsigned long long>(tickHistogram_.count()),
+                  static_cast<unsigned long long>(budgetUs_),
+                  static_cast<unsigned long long>(tickOverruns_));
+    out += line;
+
+    std::snprintf(line, sizeof(line), "  %-28s %10s %10s %10s %10s %10s %8s\n",
+                  "phase", "count", "mean_us", "p50_us", "p99_us", "max_us", "over");
+    out += line;
+
+    auto append_row = [&](const std::string& name, const LatencyHistogram& h, std::uint64_t over) {
+        std::snprintf(line, sizeof(line), "  %-28s %10llu %10.1f %10llu %10llu %10llu %8llu\n",
+                      name.c_str(),
+                      static_cast<unsigned long long>(h.count()),
+                      h.mean(),
+                      static_cast<unsigned long long>(h.percentile(50.0)),
+                      static_cast<unsigned long long>(h.percentile(99.0)),
+                      static_cast<unsigned long long>(h.max()),
+                      static_cast<unsigned long long>(over));
+        out += line;
+    };
+
+    append_row("tick", tickHistogram_, tickOverruns_);
+    for (const auto& phase : phases_) {
+        append_row(phase.name, phase.histogram, phase.overruns);
+    }
+    return out;
+}
+
+bool TickProfiler::dump_to_file(const std::filesystem::path& path) const {
+    std::ofstream file(path, std::ios::app);
+    if (!file) return false;
+    file << report() << '\n';
+    return static_cast<bool>(file);
+}
+
+void TickProfiler::reset() {
+    tickHistogram_.reset();
+    tickOverruns_ = 0;
+    for (auto& phase : phases_) {
+        phase.histogram.reset();
+        phase.overruns = 0;
+    }
+}
+
+} // namespace engine
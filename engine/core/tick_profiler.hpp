@@ -0,0 +1,134 @@
+#pragma once
+
+// =============================================================================
+// TickProfiler - Per-phase timing histograms for the server tick loop
+// Scoped timers feed log-linear latency histograms (p50/p99/max) per phase.
+// Single-threaded: all recording happens on the tick thread.
+// =============================================================================
+
+#include "export.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine {
+
+// ============================================================================
+// LatencyHistogram - HDR-style log-linear histogram (microsecond resolution)
+// ============================================================================
+
+/// Values are bucketed by power of two, each power split into kSubBuckets
+/// linear steps, giving ~6% relative error from 1 us up to several hours.
+class RAYFLOW_CORE_API LatencyHistogram {
+public:
+    static constexpr int kSubBucketBits = 4;
+    static constexpr int kSubBuckets = 1 << kSubBucketBits;
+    static constexpr int kMagnitudes = 32;
+    static constexpr int kBucketCount = kMagnitudes * kSubBuckets;
+
+    void record(std::uint64_t us);
+    void reset();
+
+    std::uint64_t count() const { return count_; }
+    std::uint64_t min() const { return count_ ? min_ : 0; }
+    std::uint64_t max() const { return max_; }
+    double mean() const { return count_ ? static_cast<double>(sum_) / static_cast<double>(count_) : 0.0; }
+
+    /// Value at the given percentile (0..100). Returns the upper bound of the
+    /// matching bucket, clamped to the observed max.
+    std::uint64_t percentile(double p) const;
+
+private:
+    static int bucket_index(std::uint64_t us);
+    static std::uint64_t bucket_upper_bound(int index);
+
+    std::array<std::uint32_t, kBucketCount> buckets_{};
+    std::uint64_t count_{0};
+    std::uint64_t sum_{0};
+    std::uint64_t min_{~0ull};
+    std::uint64_t max_{0};
+};
+
+// ============================================================================
+// TickProfiler
+// ============================================================================
+
+class RAYFLOW_CORE_API TickProfiler {
+public:
+    using PhaseId = std::uint16_t;
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr PhaseId kInvalidPhase = 0xFFFF;
+
+    struct PhaseStats {
+        std::string name;
+        LatencyHistogram histogram;
+        std::uint64_t overruns{0};  // samples above the per-phase budget
+    };
+
+    explicit TickProfiler(float tickRate = 30.0f);
+
+    /// Register a named phase (or return the existing id for that name).
+    PhaseId register_phase(std::string_view name);
+
+    /// Record a sample for a phase, in nanoseconds.
+    void record(PhaseId id, std::uint64_t ns);
+
+    /// Record the total duration of one tick and count budget overruns.
+    void end_tick(std::uint64_t tickNs);
+
+    /// Human-readable table of all phases since the last reset.
+    std::string report() const;
+
+    /// Append report() to a file. Returns false on I/O failure.
+    bool dump_to_file(const std::filesystem::path& path) const;
+
+    /// Clear all histograms and counters (phase registrations are kept).
+    void reset();
+
+    std::uint64_t budget_us() const { return budgetUs_; }
+    std::uint64_t tick_count() const { return tickHistogram_.count(); }
+    std::uint64_t tick_overruns() const { return tickOverruns_; }
+    const LatencyHistogram& tick_histogram() const { return tickHistogram_; }
+    const std::vector<PhaseStats>& phases() const { return phases_; }
+
+private:
+    std::uint64_t budgetUs_;
+    LatencyHistogram tickHistogram_;
+    std::uint64_t tickOverruns_{0};
+    std::vector<PhaseStats> phases_;
+};
+
+// ============================================================================
+// ScopedPhaseTimer - RAII helper; no-op when profiler is null
+// ============================================================================
+
+class ScopedPhaseTimer {
+public:
+    ScopedPhaseTimer(TickProfiler* profiler, TickProfiler::PhaseId id)
+        : profiler_(profiler), id_(id) {
+        if (profiler_) start_ = TickProfiler::Clock::now();
+    }
+
+    ~ScopedPhaseTimer() {
+        if (!profiler_) return;
+        const auto elapsed = TickProfiler::Clock::now() - start_;
+        profiler_->record(id_, static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+    }
+
+    ScopedPhaseTimer(const ScopedPhaseTimer&) = delete;
+    ScopedPhaseTimer& operator=(const ScopedPhaseTimer&) = delete;
+
+private:
+    TickProfiler* profiler_;
+    TickProfiler::PhaseId id_;
+    TickProfiler::Clock::time_point start_{};
+};
+
+} // namespace engine
@@ -0,0 +1,96 @@
+#include "tick_scheduler.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <ctime>
+#endif
+
+namespace engine {
+
+TickScheduler::TickScheduler(float tickRate, const Policy& policy)
+    : policy_(policy)
+    , period_(std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / tickRate)))
+    , nextTick_(Clock::now())
+{
+    policy_.maxCatchUpTicks = std::max<std::uint32_t>(policy_.maxCatchUpTicks, 1);
+}
+
+void TickScheduler::reset() {
+    nextTick_ = Clock::now();
+}
+
+std::uint32_t TickScheduler::wait_for_ticks() {
+    auto now = Clock::now();
+    if (now < nextTick_) {
+        wait_until(nextTick_);
+        now = Clock::now();
+    }
+
+    const auto lateness = now - nextTick_;
+    const auto latenessUs = static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(lateness).count());
+
+    // Every deadline up to now is due: the current one plus whole periods missed.
+    const auto due = static_cast<std::uint64_t>(lateness / period_) + 1;
+    const auto run = static_cast<std::uint32_t>(std::min<std::uint64_t>(due, policy_.maxCatchUpTicks));
+
+    stats_.ticks += run;
+    stats_.catchUpTicks += run - 1;
+    stats_.missedTicks += due - run;
+    if (latenessUs > policy_.lateToleranceMicros) {
+        ++stats_.lateTicks;
+    }
+    stats_.maxLatenessUs = std::max(stats_.maxLatenessUs, latenessUs);
+
+    nextTick_ += period_ * static_cast<Clock::rep>(due);
+    return run;
+}
+
+std::string TickScheduler::report() const {
+    char buf[160];
+    std::snprintf(buf, sizeof(buf),
+                  "ticks=%llu late=%llu catch_up=%llu missed=%llu max_late=%lluus",
+                  static_cast<unsigned long long>(stats_.ticks),
+                  static_cast<unsigned long long>(stats_.lateTicks),
+                  static_cast<unsigned long long>(stats_.catchUpTicks),
+                  static_cast<unsigned long long>(stats_.missedTicks),
+                  static_cast<unsigned long long>(stats_.maxLatenessUs));
+    return buf;
+}
+
+void TickScheduler::wait_until(Clock::time_point deadline) const {
+    if (policy_.waitMode == WaitMode::Sleep) {
+        std::this_thread::sleep_until(deadline);
+        return;
+    }
+
+    const auto wakeAt = deadline - std::chrono::microseconds(policy_.spinMicros);
+
+#if defined(__linux__)
+    if (policy_.waitMode == WaitMode::AbsoluteTimer) {
+        // steady_clock is CLOCK_MONOTONIC on Linux, so its epoch can be
+        // handed to the kernel as an absolute deadline.
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(wakeAt.time_since_epoch()).count();
+        if (ns > 0) {
+            timespec ts{};
+            ts.tv_sec = static_cast<time_t>(ns / 1'000'000'000);
+            ts.tv_nsec = static_cast<long>(ns % 1'000'000'000);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {
+            }
+        }
+    } else
+#endif
+    if (Clock::now() < wakeAt) {
+        std::this_thread::sleep_until(wakeAt);
+    }
+
+    // Spin out the remainder so wake-up jitter stays off the deadline
+    while (Clock::now() < deadline) {
+    }
+}
+
+} // namespace engine
@@ -0,0 +1,77 @@
+#pragma once
+
+// =============================================================================
+// TickScheduler - Drift-free fixed-step pacing for server tick loops
+// Tick deadlines lie on a fixed grid (start + n * period), so oversleep never
+// accumulates. A loop that falls behind simulates the overdue ticks back to
+// back, up to a cap; anything beyond the cap is skipped and counted.
+// =============================================================================
+
+#include "export.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace engine {
+
+class RAYFLOW_CORE_API TickScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class WaitMode : std::uint8_t {
+        Sleep,          // sleep_until the deadline (cheapest, 50-100us late on Linux)
+        SleepSpin,      // sleep until spinMicros before the deadline, then spin
+        AbsoluteTimer,  // clock_nanosleep(TIMER_ABSTIME) then spin; SleepSpin off Linux
+    };
+
+    struct Policy {
+        WaitMode waitMode = WaitMode::SleepSpin;
+
+        /// Final stretch before each deadline that is busy-waited.
+        std::uint32_t spinMicros = 200;
+
+        /// Most ticks run back to back after a stall; older ones are skipped.
+        std::uint32_t maxCatchUpTicks = 5;
+
+        /// A tick starting later than this after its deadline counts as late.
+        std::uint32_t lateToleranceMicros = 500;
+    };
+
+    struct Stats {
+        std::uint64_t ticks{0};         // ticks handed out
+        std::uint64_t lateTicks{0};     // started past lateToleranceMicros
+        std::uint64_t catchUpTicks{0};  // extra ticks run back to back
+        std::uint64_t missedTicks{0};   // skipped beyond maxCatchUpTicks
+        std::uint64_t maxLatenessUs{0};
+    };
+
+    TickScheduler(float tickRate, const Policy& policy);
+
+    /// Restart the grid at the current time (call right before the loop).
+    void reset();
+
+    /// Block until the next deadline and return how many ticks to simulate
+    /// now (at least 1). The deadline grid advances by every overdue tick,
+    /// including skipped ones, so the phase never drifts.
+    std::uint32_t wait_for_ticks();
+
+    const Stats& stats() const { return stats_; }
+    void reset_stats() { stats_ = {}; }
+
+    /// One-line summary of stats().
+    std::string report() const;
+
+    const Policy& policy() const { return policy_; }
+    Clock::duration period() const { return period_; }
+
+private:
+    void wait_until(Clock::time_point deadline) const;
+
+    Policy policy_;
+    Clock::duration period_;
+    Clock::time_point nextTick_;
+    Stats stats_;
+};
+
+} // namespace engine
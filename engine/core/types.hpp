@@ -14,6 +14,17 @@ using Tick = std::uint64_t;
 
 static constexpr PlayerId kInvalidPlayerId = 0;
 
+// ============================================================================
+// Delivery
+// ============================================================================
+
+/// How a message travels. Transports map this onto their own channels/flags.
+enum class Delivery : std::uint8_t {
+    ReliableOrdered = 0,      // Retransmitted until acknowledged, in order
+    UnreliableSequenced = 1,  // May be lost; a packet older than the newest received is dropped
+    UnreliableFragment = 2,   // As UnreliableSequenced, and stays unreliable above the MTU
+};
+
 // ============================================================================
 // Logging
 // ============================================================================
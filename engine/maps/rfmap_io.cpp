@@ -4,7 +4,9 @@
 #include <cstring>
 #include <fstream>
 #include <limits>
+#include <mutex>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 namespace shared::maps {
@@ -1120,4 +1122,44 @@ bool read_rfmap_from_memory(const void* data,
     return true;
 }
 
+SharedMapTemplate read_rfmap_shared(const std::filesystem::path& path,
+                                    std::string* outError) {
+    struct CacheEntry {
+        std::filesystem::file_time_type writeTime{};
+        std::weak_ptr<const MapTemplate> map;
+    };
+    static std::mutex cacheMutex;
+    static std::unordered_map<std::string, CacheEntry> cache;
+
+    std::error_code ec;
+    auto canonical = std::filesystem::weakly_canonical(path, ec);
+    if (ec) canonical = path;
+    const auto writeTime = std::filesystem::last_write_time(canonical, ec);
+    const std::string key = canonical.string();
+
+    std::lock_guard lock(cacheMutex);
+
+    if (!ec) {
+        if (auto it = cache.find(key); it != cache.end() && it->second.writeTime == writeTime) {
+            if (auto alive = it->second.map.lock()) {
+                return alive;
+            }
+        }
+    }
+
+    auto map = std::make_shared<MapTemplate>();
+    if (!read_rfmap(canonical, map.get(), outError)) {
+        return nullptr;
+    }
+
+    SharedMapTemplate shared = std::move(map);
+    if (!ec) {
+        // Drop maps nobody holds any more, so rotating through many maps
+        // doesn't grow the cache
+        std::erase_if(cache, [](const auto& entry) { return entry.second.map.expired(); });
+        cache[key] = CacheEntry{writeTime, shared};
+    }
+    return shared;
+}
+
 } // namespace shared::maps
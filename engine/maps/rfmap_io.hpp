@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <filesystem>
 #include <functional>
+#include <memory>
 #include <unordered_map>
 #include <string>
 #include <utility>
@@ -99,6 +100,10 @@ struct MapTemplate {
     }
 };
 
+// Immutable, refcounted template. Matches and in-process clients that load the
+// same map share one instance; per-match edits live in their own overrides.
+using SharedMapTemplate = std::shared_ptr<const MapTemplate>;
+
 inline MapTemplate::VisualSettings default_visual_settings() {
     // MV-1 defaults when section is missing.
     MapTemplate::VisualSettings s{};
@@ -155,4 +160,11 @@ RAYFLOW_CORE_API bool read_rfmap_from_memory(const void* data,
                             MapTemplate* outMap,
                             std::string* outError);
 
+// Reads a `.rfmap` template through a process-wide cache keyed by canonical
+// path and last write time. While any holder keeps the result alive, further
+// loads of the unchanged file return the same instance. Thread-safe.
+// On failure returns nullptr and fills outError (if provided).
+RAYFLOW_CORE_API SharedMapTemplate read_rfmap_shared(const std::filesystem::path& path,
+                                                     std::string* outError);
+
 } // namespace shared::maps
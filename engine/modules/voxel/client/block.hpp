@@ -11,9 +11,15 @@ constexpr int CHUNK_HEIGHT = shared::voxel::CHUNK_HEIGHT;
 constexpr int CHUNK_DEPTH = shared::voxel::CHUNK_DEPTH;
 constexpr int CHUNK_SIZE = shared::voxel::CHUNK_SIZE;
 
+// Chunks are meshed, lit and culled in 16-block vertical sections
+constexpr int CHUNK_SECTION_HEIGHT = 16;
+constexpr int CHUNK_SECTIONS = CHUNK_HEIGHT / CHUNK_SECTION_HEIGHT;
+constexpr int CHUNK_SECTION_SIZE = CHUNK_WIDTH * CHUNK_SECTION_HEIGHT * CHUNK_DEPTH;
+
 inline bool is_solid(BlockType type) { return shared::voxel::util::is_solid(type); }
 inline bool is_transparent(BlockType type) { return shared::voxel::util::is_transparent(type); }
 inline bool is_vegetation(BlockType type) { return shared::voxel::is_vegetation(type); }
+inline bool is_full_opaque(BlockType type) { return shared::voxel::util::is_full_opaque(type); }
 
 using Block = std::uint8_t;
 
@@ -2,6 +2,8 @@
 
 #include "engine/core/export.hpp"
 #include "block.hpp"
+#include "chunk_mesher.hpp"
+#include "skylight.hpp"
 #include "../shared/block_state.hpp"
 #include "engine/core/math_types.hpp"
 #include "engine/renderer/gl_mesh.hpp"
@@ -36,57 +38,124 @@ public:
     
     void set_block_with_state(int x, int y, int z, Block type, shared::voxel::BlockRuntimeState state);
     
-    void calculate_lighting(const World& world);
     std::uint8_t get_light(int x, int y, int z) const;
     void set_light(int x, int y, int z, std::uint8_t value);
 
+    /// Raw storage for SkylightPropagator (Chunk layout: y*256 + z*16 + x).
+    const Block* block_data() const { return blocks_.data(); }
+    LightNibbles& light() { return light_; }
+
+    /// Top of the highest section holding any block; everything at or
+    /// above it is air.
+    int height() const;
+
+    /// Section has no blocks at all / is filled with full opaque cubes.
+    bool section_empty(int section) const { return sections_[section].non_air == 0; }
+    bool section_solid(int section) const { return sections_[section].full_opaque == CHUNK_SECTION_SIZE; }
+
+    /// Remesh every section synchronously on the calling thread.
     void generate_mesh(const World& world);
     
-    /// Draw this chunk's mesh (shader must already be bound).
+    /// Copy this chunk's cells around a section into a mesh snapshot.
+    void copy_to_mesh_input(ChunkMeshInput& input) const;
+    
+    /// Copy a border slab of this chunk into a neighbour's snapshot apron:
+    /// local x in [x0, x1), z in [z0, z1), stored at (x + dx, z + dz).
+    void copy_border_to_mesh_input(ChunkMeshInput& input, int x0, int x1, int z0, int z1,
+                                   int dx, int dz) const;
+    
+    /// Main-thread half of meshing: upload a section's built vertex arrays
+    /// to the GPU.
+    void apply_mesh(int section, const ChunkMeshData& data);
+    
+    /// Nothing in the section can be seen: drop its mesh without building one.
+    void skip_mesh(int section);
+    
+    /// Draw every section's mesh (shader must already be bound, with
+    /// chunkOrigin set to get_world_position()).
     void render() const;
     
-    /// Draw with a specific shader (binds uniform for model matrix).
+    /// Draw one section's mesh, if it has one.
+    bool has_section_mesh(int section) const { return sections_[section].has_mesh; }
+    void render_section(int section) const;
+    
+    /// Draw with a specific shader (binds model matrix and chunkOrigin).
     void render(rf::GLShader& shader) const;
     
     int get_chunk_x() const { return chunk_x_; }
     int get_chunk_z() const { return chunk_z_; }
     rf::Vec3 get_world_position() const { return world_position_; }
-    bool needs_mesh_update() const { return needs_mesh_update_; }
+    bool needs_mesh_update() const;
+    bool section_needs_mesh_update(int section) const { return sections_[section].needs_mesh_update; }
+    
+    /// Any dirty section without a mesh job in flight.
+    bool has_unscheduled_mesh_update() const;
+    
+    /// Bumped on every change that invalidates a section's mesh; a mesh
+    /// built from an older snapshot is stale.
+    std::uint64_t section_mesh_version(int section) const { return sections_[section].mesh_version; }
+    
+    /// Ticket of the background mesh job in flight for a section (0 = none).
+    std::uint64_t section_mesh_ticket(int section) const { return sections_[section].mesh_ticket; }
+    void set_section_mesh_ticket(int section, std::uint64_t ticket) { sections_[section].mesh_ticket = ticket; }
     bool is_generated() const { return is_generated_; }
-    bool is_empty() const { return is_empty_; }
+    bool is_empty() const { return height() == 0; }
     
-    void mark_dirty() { 
-        needs_mesh_update_ = true;
+    /// Every section, or the sections in a bitmask (bit n = section n).
+    void mark_dirty() { mark_dirty(kAllSections); }
+    void mark_dirty(std::uint32_t sections) {
+        invalidate_mesh(sections);
         if (on_marked_dirty_) on_marked_dirty_(this);
     }
     void set_generated(bool value) { is_generated_ = value; }
     
+    static constexpr std::uint32_t kAllSections = (1u << CHUNK_SECTIONS) - 1;
+    
+    /// Sections whose mesh can see the block at height y (its own, plus
+    /// the neighbouring one when y is on a section boundary).
+    static std::uint32_t sections_touching(int y);
+    
     void set_dirty_callback(std::function<void(Chunk*)> callback) { on_marked_dirty_ = callback; }
     
 private:
+    struct Section {
+        std::uint16_t non_air{0};
+        std::uint16_t full_opaque{0};
+        bool needs_mesh_update{true};
+        bool has_mesh{false};
+        std::uint64_t mesh_version{0};
+        std::uint64_t mesh_ticket{0};
+        rf::GLMesh mesh;
+        std::vector<rf::Vec3> light_markers_ws;
+    };
+    
     static int get_index(int x, int y, int z);
     bool is_valid_position(int x, int y, int z) const;
     void cleanup_mesh();
+    void invalidate_mesh(std::uint32_t sections) {
+        for (int s = 0; s < CHUNK_SECTIONS; ++s) {
+            if (sections & (1u << s)) {
+                sections_[s].needs_mesh_update = true;
+                ++sections_[s].mesh_version;
+            }
+        }
+    }
+    void count_block(int y, Block type, int delta);
     
     std::function<void(Chunk*)> on_marked_dirty_;
     
     std::array<Block, CHUNK_SIZE> blocks_{};
-    std::array<std::uint8_t, CHUNK_SIZE> light_map_{};
+    LightNibbles light_{};
     std::unordered_map<int, shared::voxel::BlockRuntimeState> block_states_{};
     
     rf::Vec3 world_position_{0, 0, 0};
     int chunk_x_{0};
     int chunk_z_{0};
     
-    bool needs_mesh_update_{true};
     bool is_generated_{false};
-    bool has_mesh_{false};
-    bool is_empty_{false};
     
-    // GPU mesh (Phase 2: real OpenGL VAO/VBO)
-    rf::GLMesh mesh_;
-
-    std::vector<rf::Vec3> light_markers_ws_{};
+    // Per-section block counts, GPU meshes and mesh bookkeeping
+    std::array<Section, CHUNK_SECTIONS> sections_{};
 };
 
 } // namespace voxel
@@ -0,0 +1,109 @@
+#include "chunk_mesh_workers.hpp"
+
+#include <algorithm>
+
+namespace voxel {
+
+namespace {
+
+// Meshing competes with the render thread and the driver; a few workers
+// already drain a full map load faster than uploads can keep up.
+constexpr std::size_t kMaxDefaultThreads = 4;
+
+} // namespace
+
+ChunkMeshWorkers::ChunkMeshWorkers(std::size_t threadCount, std::size_t maxInFlight)
+    : completed_(std::max<std::size_t>(maxInFlight, 1))
+    , maxInFlight_(std::max<std::size_t>(maxInFlight, 1)) {
+    threads_.reserve(threadCount);
+    for (std::size_t i = 0; i < threadCount; ++i) {
+        threads_.emplace_back([this]() { worker_loop(); });
+    }
+}
+
+ChunkMeshWorkers::~ChunkMeshWorkers() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wakeCv_.notify_all();
+    for (auto& t : threads_) {
+        if (t.joinable()) t.join();
+    }
+}
+
+std::size_t ChunkMeshWorkers::default_thread_count() {
+    const unsigned hw = std::thread::hardware_concurrency();
+    return hw > 1 ? std::min<std::size_t>(hw - 1, kMaxDefaultThreads) : 0;
+}
+
+ChunkMeshJob ChunkMeshWorkers::make_job() {
+    ChunkMeshJob job;
+    if (!freeInputs_.empty()) {
+        job.input = std::move(freeInputs_.back());
+        freeInputs_.pop_back();
+    } else {
+        job.input = std::make_unique<ChunkMeshInput>();
+    }
+    if (!freeOutputs_.empty()) {
+        job.output = std::move(freeOutputs_.back());
+        freeOutputs_.pop_back();
+    } else {
+        job.output = std::make_unique<ChunkMeshData>();
+    }
+    return job;
+}
+
+void ChunkMeshWorkers::submit(ChunkMeshJob&& job) {
+    ++inFlight_;
+
+    if (threads_.empty()) {
+        build_chunk_mesh(*job.input, *job.context, *job.output);
+        complete(std::move(job));
+        return;
+    }
+
+    {
+        std::lock_guard lock(mutex_);
+        pending_.push_back(std::move(job));
+    }
+    wakeCv_.notify_one();
+}
+
+bool ChunkMeshWorkers::try_pop_completed(ChunkMeshJob& out) {
+    if (!completed_.try_pop(out)) return false;
+    --inFlight_;
+    return true;
+}
+
+void ChunkMeshWorkers::recycle(ChunkMeshJob&& job) {
+    if (job.input) freeInputs_.push_back(std::move(job.input));
+    if (job.output) freeOutputs_.push_back(std::move(job.output));
+    job.context.reset();
+}
+
+void ChunkMeshWorkers::complete(ChunkMeshJob&& job) {
+    // Capacity covers every in-flight job, so this only spins if the
+    // consumer is mid-pop on the slot we need.
+    while (!completed_.try_push(std::move(job))) {
+        std::this_thread::yield();
+    }
+}
+
+void ChunkMeshWorkers::worker_loop() {
+    for (;;) {
+        ChunkMeshJob job;
+        {
+            std::unique_lock lock(mutex_);
+            wakeCv_.wait(lock, [this]() { return stopping_ || !pending_.empty(); });
+            if (stopping_) return;
+            job = std::move(pending_.front());
+            pending_.pop_front();
+        }
+
+        build_chunk_mesh(*job.input, *job.context, *job.output);
+        complete(std::move(job));
+    }
+}
+
+} // namespace voxel
@@ -0,0 +1,81 @@
+#pragma once
+
+// =============================================================================
+// ChunkMeshWorkers - Background threads for the CPU half of chunk meshing
+// The main thread submits snapshot jobs and later pops finished ones from a
+// completion queue to upload; workers never see the live World or GL.
+// =============================================================================
+
+#include "engine/core/export.hpp"
+#include "engine/core/lockfree_queue.hpp"
+#include "chunk_mesher.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace voxel {
+
+struct ChunkMeshJob {
+    std::uint64_t ticket{0};   // Unique per submission; matches Chunk::section_mesh_ticket()
+    std::uint64_t version{0};  // Chunk::section_mesh_version() when the snapshot was taken
+    std::unique_ptr<ChunkMeshInput> input;
+    std::unique_ptr<ChunkMeshData> output;
+    std::shared_ptr<const ChunkMeshContext> context;
+};
+
+class RAYFLOW_VOXEL_API ChunkMeshWorkers {
+public:
+    /// threadCount 0 builds each job inline inside submit(). At most
+    /// maxInFlight jobs may be submitted and not yet popped.
+    ChunkMeshWorkers(std::size_t threadCount, std::size_t maxInFlight);
+    ~ChunkMeshWorkers();
+
+    ChunkMeshWorkers(const ChunkMeshWorkers&) = delete;
+    ChunkMeshWorkers& operator=(const ChunkMeshWorkers&) = delete;
+
+    // --- Main thread only ---
+
+    /// A job with input/output buffers from the recycle pool.
+    ChunkMeshJob make_job();
+
+    /// Queue a job (requires can_submit()).
+    void submit(ChunkMeshJob&& job);
+
+    /// Take one finished job, in completion order.
+    bool try_pop_completed(ChunkMeshJob& out);
+
+    /// Return a popped job's buffers so later jobs reuse their capacity.
+    void recycle(ChunkMeshJob&& job);
+
+    bool can_submit() const { return inFlight_ < maxInFlight_; }
+    std::size_t in_flight() const { return inFlight_; }
+    std::size_t thread_count() const { return threads_.size(); }
+
+    /// Hardware threads minus the main thread, capped; 0 on a single core.
+    static std::size_t default_thread_count();
+
+private:
+    void worker_loop();
+    void complete(ChunkMeshJob&& job);
+
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable wakeCv_;
+    std::deque<ChunkMeshJob> pending_;
+    bool stopping_{false};
+
+    engine::MpscQueue<ChunkMeshJob> completed_;
+
+    std::size_t maxInFlight_;
+    std::size_t inFlight_{0};
+    std::vector<std::unique_ptr<ChunkMeshInput>> freeInputs_;
+    std::vector<std::unique_ptr<ChunkMeshData>> freeOutputs_;
+};
+
+} // namespace voxel
@@ -0,0 +1,600 @@
+#include "chunk_mesher.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace voxel {
+
+namespace {
+
+int chunk_index(int x, int y, int z) {
+    return y * CHUNK_WIDTH * CHUNK_DEPTH + z * CHUNK_WIDTH + x;
+}
+
+} // namespace
+
+// ============================================================================
+// ChunkMeshInput / ChunkMeshData
+// ============================================================================
+
+void ChunkMeshInput::reset(int cx, int cz, int section_index) {
+    chunk_x = cx;
+    chunk_z = cz;
+    section = section_index;
+    blocks.assign(kPadSize, static_cast<Block>(BlockType::Air));
+    skylight.assign(kPadSize, 15);
+    states.clear();
+}
+
+shared::voxel::BlockRuntimeState ChunkMeshInput::state(int x, int y, int z) const {
+    auto it = states.find(chunk_index(x, y, z));
+    return it != states.end() ? it->second : shared::voxel::BlockRuntimeState::defaults();
+}
+
+void ChunkMeshData::clear() {
+    vertices.clear();
+    light_markers.clear();
+    empty = false;
+    build_ms = 0.0f;
+}
+
+// ============================================================================
+// Mesh build
+// ============================================================================
+
+void build_chunk_mesh(const ChunkMeshInput& in, const ChunkMeshContext& ctx, ChunkMeshData& out) {
+    const auto t0 = std::chrono::steady_clock::now();
+    out.clear();
+
+    const int base_y = in.base_y();
+
+    bool has_solid_blocks = false;
+    for (int y = 0; y < CHUNK_SECTION_HEIGHT && !has_solid_blocks; ++y) {
+        for (int z = 0; z < CHUNK_DEPTH && !has_solid_blocks; ++z) {
+            const Block* row = &in.blocks[ChunkMeshInput::index(0, y, z)];
+            for (int x = 0; x < CHUNK_WIDTH; ++x) {
+                if (row[x] != static_cast<Block>(BlockType::Air)) {
+                    has_solid_blocks = true;
+                    break;
+                }
+            }
+        }
+    }
+    if (!has_solid_blocks) {
+        out.empty = true;
+        return;
+    }
+
+    const float origin_x = static_cast<float>(in.chunk_x * CHUNK_WIDTH);
+    const float origin_z = static_cast<float>(in.chunk_z * CHUNK_DEPTH);
+
+    constexpr size_t ESTIMATED_QUADS = CHUNK_SECTION_SIZE / 3;
+
+    std::vector<PackedChunkVertex>& vertices = out.vertices;
+    vertices.reserve(ESTIMATED_QUADS * 4);
+
+    // Faces are emitted as quads (corners 0,1,2,3) that the shared quad index
+    // buffer draws as triangles (0,1,2) and (0,2,3). The 6-vertex tables below
+    // list both triangles; vertices 0,1,2,5 are the distinct corners.
+    static const int quad_corner_vertex[4] = {0, 1, 2, 5};
+
+    static const float face_vertices[6][6][3] = {
+        // +X face
+        {{1,0,0}, {1,1,0}, {1,1,1}, {1,0,0}, {1,1,1}, {1,0,1}},
+        // -X face
+        {{0,0,1}, {0,1,1}, {0,1,0}, {0,0,1}, {0,1,0}, {0,0,0}},
+        // +Y face (top)
+        {{0,1,0}, {0,1,1}, {1,1,1}, {0,1,0}, {1,1,1}, {1,1,0}},
+        // -Y face (bottom)
+        {{0,0,1}, {0,0,0}, {1,0,0}, {0,0,1}, {1,0,0}, {1,0,1}},
+        // +Z face
+        {{1,0,1}, {1,1,1}, {0,1,1}, {1,0,1}, {0,1,1}, {0,0,1}},
+        // -Z face
+        {{0,0,0}, {0,1,0}, {1,1,0}, {0,0,0}, {1,1,0}, {1,0,0}}
+    };
+
+    static const float face_uvs[6][6][2] = {
+        // +X face
+        {{1,1}, {1,0}, {0,0}, {1,1}, {0,0}, {0,1}},
+        // -X face
+        {{1,1}, {1,0}, {0,0}, {1,1}, {0,0}, {0,1}},
+        // +Y face (top)
+        {{0,0}, {0,1}, {1,1}, {0,0}, {1,1}, {1,0}},
+        // -Y face (bottom)
+        {{0,1}, {0,0}, {1,0}, {0,1}, {1,0}, {1,1}},
+        // +Z face
+        {{1,1}, {1,0}, {0,0}, {1,1}, {0,0}, {0,1}},
+        // -Z face
+        {{1,1}, {1,0}, {0,0}, {1,1}, {0,0}, {0,1}}
+    };
+
+    static const int face_dir[6][3] = {
+        { 1, 0, 0}, {-1, 0, 0},
+        { 0, 1, 0}, { 0,-1, 0},
+        { 0, 0, 1}, { 0, 0,-1}
+    };
+
+    static const int face_u[6][3] = {
+        { 0, 0, 1}, { 0, 0,-1},
+        { 1, 0, 0}, { 1, 0, 0},
+        {-1, 0, 0}, { 1, 0, 0}
+    };
+    static const int face_v[6][3] = {
+        { 0, 1, 0}, { 0, 1, 0},
+        { 0, 0, 1}, { 0, 0,-1},
+        { 0, 1, 0}, { 0, 1, 0}
+    };
+
+    // All neighbour lookups below use chunk-local coordinates; the snapshot
+    // apron covers the one block they can reach outside the section.
+    // Returns an index into kChunkAoLevels.
+    auto calc_corner_ao = [&in](int x, int y, int z,
+                                const int* dir,
+                                const int* u_axis,
+                                const int* v_axis,
+                                int u_sign, int v_sign) -> int {
+        const int side1_x = x + dir[0] + u_axis[0] * u_sign;
+        const int side1_y = y + dir[1] + u_axis[1] * u_sign;
+        const int side1_z = z + dir[2] + u_axis[2] * u_sign;
+
+        const int side2_x = x + dir[0] + v_axis[0] * v_sign;
+        const int side2_y = y + dir[1] + v_axis[1] * v_sign;
+        const int side2_z = z + dir[2] + v_axis[2] * v_sign;
+
+        const int corner_x = x + dir[0] + u_axis[0] * u_sign + v_axis[0] * v_sign;
+        const int corner_y = y + dir[1] + u_axis[1] * u_sign + v_axis[1] * v_sign;
+        const int corner_z = z + dir[2] + u_axis[2] * u_sign + v_axis[2] * v_sign;
+
+        const bool s1 = is_solid(static_cast<BlockType>(in.block(side1_x, side1_y, side1_z)));
+        const bool s2 = is_solid(static_cast<BlockType>(in.block(side2_x, side2_y, side2_z)));
+        const bool c  = is_solid(static_cast<BlockType>(in.block(corner_x, corner_y, corner_z)));
+
+        if (s1 && s2) {
+            return 0;
+        }
+        return 3 - (s1 ? 1 : 0) - (s2 ? 1 : 0) - (c ? 1 : 0);
+    };
+
+    static const int corner_u_sign[4] = { -1, -1, +1, +1 };
+    static const int corner_v_sign[4] = { -1, +1, +1, -1 };
+
+    auto face_corner_ao = [&](int x, int y, int z, int face, int corner_ao[4]) {
+        for (int corner = 0; corner < 4; corner++) {
+            corner_ao[corner] = calc_corner_ao(
+                x, y, z,
+                face_dir[face],
+                face_u[face],
+                face_v[face],
+                corner_u_sign[corner],
+                corner_v_sign[corner]
+            );
+        }
+    };
+
+    // Append one quad. pos/uv are per corner (chunk-local / tile units).
+    auto emit_quad = [&vertices](const float pos[4][3], const float uv[4][2], int normal, int tile,
+                                 int light, const int ao[4], ChunkTint tint, bool repeat) {
+        for (int corner = 0; corner < 4; ++corner) {
+            ChunkVertex v;
+            v.position = rf::Vec3{pos[corner][0], pos[corner][1], pos[corner][2]};
+            v.uv = rf::Vec2{uv[corner][0], uv[corner][1]};
+            v.normal = normal;
+            v.repeat = repeat;
+            v.light = light;
+            v.ao = ao[corner];
+            v.tint = tint;
+            v.tile = tile;
+            vertices.push_back(encode_chunk_vertex(v));
+        }
+    };
+
+    auto should_cull_model_face = [&in, &ctx](int nx, int ny, int nz) -> bool {
+        auto neighbor_type = static_cast<BlockType>(in.block(nx, ny, nz));
+
+        if (is_transparent(neighbor_type)) return false;
+
+        const auto* neighbor_model = ctx.model(neighbor_type);
+        if (!neighbor_model) {
+            return true;
+        }
+
+        return neighbor_model->shape == shared::voxel::BlockShape::Full;
+    };
+
+    auto add_element_face = [&](
+        const shared::voxel::ModelElement& elem,
+        int face_idx,
+        BlockType block_type,
+        int x, int y, int z,
+        ChunkTint tint
+    ) {
+        float x0 = elem.from[0] / 16.0f;
+        float y0 = elem.from[1] / 16.0f;
+        float z0 = elem.from[2] / 16.0f;
+        float x1 = elem.to[0] / 16.0f;
+        float y1 = elem.to[1] / 16.0f;
+        float z1 = elem.to[2] / 16.0f;
+
+        float fv[4][3];
+        switch (face_idx) {
+            case 0: // +X (East)
+                fv[0][0] = x1; fv[0][1] = y0; fv[0][2] = z0;
+                fv[1][0] = x1; fv[1][1] = y1; fv[1][2] = z0;
+                fv[2][0] = x1; fv[2][1] = y1; fv[2][2] = z1;
+                fv[3][0] = x1; fv[3][1] = y0; fv[3][2] = z1;
+                break;
+            case 1: // -X (West)
+                fv[0][0] = x0; fv[0][1] = y0; fv[0][2] = z1;
+                fv[1][0] = x0; fv[1][1] = y1; fv[1][2] = z1;
+                fv[2][0] = x0; fv[2][1] = y1; fv[2][2] = z0;
+                fv[3][0] = x0; fv[3][1] = y0; fv[3][2] = z0;
+                break;
+            case 2: // +Y (Up)
+                fv[0][0] = x0; fv[0][1] = y1; fv[0][2] = z0;
+                fv[1][0] = x0; fv[1][1] = y1; fv[1][2] = z1;
+                fv[2][0] = x1; fv[2][1] = y1; fv[2][2] = z1;
+                fv[3][0] = x1; fv[3][1] = y1; fv[3][2] = z0;
+                break;
+            case 3: // -Y (Down)
+                fv[0][0] = x0; fv[0][1] = y0; fv[0][2] = z1;
+                fv[1][0] = x0; fv[1][1] = y0; fv[1][2] = z0;
+                fv[2][0] = x1; fv[2][1] = y0; fv[2][2] = z0;
+                fv[3][0] = x1; fv[3][1] = y0; fv[3][2] = z1;
+                break;
+            case 4: // +Z (South)
+                fv[0][0] = x1; fv[0][1] = y0; fv[0][2] = z1;
+                fv[1][0] = x1; fv[1][1] = y1; fv[1][2] = z1;
+                fv[2][0] = x0; fv[2][1] = y1; fv[2][2] = z1;
+                fv[3][0] = x0; fv[3][1] = y0; fv[3][2] = z1;
+                break;
+            case 5: // -Z (North)
+                fv[0][0] = x0; fv[0][1] = y0; fv[0][2] = z0;
+                fv[1][0] = x0; fv[1][1] = y1; fv[1][2] = z0;
+                fv[2][0] = x1; fv[2][1] = y1; fv[2][2] = z0;
+                fv[3][0] = x1; fv[3][1] = y0; fv[3][2] = z0;
+                break;
+        }
+        for (auto& corner : fv) {
+            corner[0] += static_cast<float>(x);
+            corner[1] += static_cast<float>(y);
+            corner[2] += static_cast<float>(z);
+        }
+
+        const auto& face_data = elem.faces[face_idx];
+        float u0 = face_data.uv[0] / 16.0f;
+        float v0 = face_data.uv[1] / 16.0f;
+        float u1 = face_data.uv[2] / 16.0f;
+        float v1 = face_data.uv[3] / 16.0f;
+
+        float fuv[4][2];
+        switch (face_idx) {
+            case 0: case 1: case 4: case 5: // Side faces
+                fuv[0][0] = u1; fuv[0][1] = v1;
+                fuv[1][0] = u1; fuv[1][1] = v0;
+                fuv[2][0] = u0; fuv[2][1] = v0;
+                fuv[3][0] = u0; fuv[3][1] = v1;
+                break;
+            case 2: // +Y (top)
+                fuv[0][0] = u0; fuv[0][1] = v0;
+                fuv[1][0] = u0; fuv[1][1] = v1;
+                fuv[2][0] = u1; fuv[2][1] = v1;
+                fuv[3][0] = u1; fuv[3][1] = v0;
+                break;
+            case 3: // -Y (bottom)
+                fuv[0][0] = u0; fuv[0][1] = v1;
+                fuv[1][0] = u0; fuv[1][1] = v0;
+                fuv[2][0] = u1; fuv[2][1] = v0;
+                fuv[3][0] = u1; fuv[3][1] = v1;
+                break;
+        }
+
+        int corner_ao[4];
+        face_corner_ao(x, y, z, face_idx, corner_ao);
+
+        const int face_light = in.light(
+            x + face_dir[face_idx][0], y + face_dir[face_idx][1], z + face_dir[face_idx][2]);
+
+        emit_quad(fv, fuv, face_idx, ctx.tile(block_type, face_idx), face_light, corner_ao, tint, false);
+    };
+
+    // Cross-shaped vegetation (tall grass, flowers): two diagonal quads,
+    // each emitted front and back, forming an X when viewed from above.
+    auto add_cross_model = [&](int x, int y, int z, BlockType block_type, int block_light, ChunkTint tint) {
+        const int tile = ctx.tile(block_type, 0);
+
+        // Offset to center the cross slightly for visual appeal
+        const float offset = 0.15f;  // Small offset from block edges
+        const float lo = offset;
+        const float hi = 1.0f - offset;
+
+        // Diagonal plane 1 (NW-SE): from (offset, 0, offset) to (1-offset, 1, 1-offset)
+        const float cross1_verts[4][3] = {{lo, 0.0f, lo}, {lo, 1.0f, lo}, {hi, 1.0f, hi}, {hi, 0.0f, hi}};
+        const float cross1b_verts[4][3] = {{hi, 0.0f, hi}, {hi, 1.0f, hi}, {lo, 1.0f, lo}, {lo, 0.0f, lo}};
+        // Diagonal plane 2 (NE-SW): from (1-offset, 0, offset) to (offset, 1, 1-offset)
+        const float cross2_verts[4][3] = {{hi, 0.0f, lo}, {hi, 1.0f, lo}, {lo, 1.0f, hi}, {lo, 0.0f, hi}};
+        const float cross2b_verts[4][3] = {{lo, 0.0f, hi}, {lo, 1.0f, hi}, {hi, 1.0f, lo}, {hi, 0.0f, lo}};
+        static const float cross_uvs[4][2] = {{0.0f, 1.0f}, {0.0f, 0.0f}, {1.0f, 0.0f}, {1.0f, 1.0f}};
+
+        // No AO for cross models (they're transparent)
+        static const int no_ao[4] = {3, 3, 3, 3};
+
+        auto emit_cross_face = [&](const float verts[4][3], int normal) {
+            float pos[4][3];
+            for (int corner = 0; corner < 4; ++corner) {
+                pos[corner][0] = static_cast<float>(x) + verts[corner][0];
+                pos[corner][1] = static_cast<float>(y) + verts[corner][1];
+                pos[corner][2] = static_cast<float>(z) + verts[corner][2];
+            }
+            emit_quad(pos, cross_uvs, normal, tile, block_light, no_ao, tint, false);
+        };
+
+        emit_cross_face(cross1_verts, 6);
+        emit_cross_face(cross1b_verts, 7);
+        emit_cross_face(cross2_verts, 8);
+        emit_cross_face(cross2b_verts, 9);
+    };
+
+    const auto cube_tint = [](BlockType block_type, int face) -> ChunkTint {
+        if (block_type == BlockType::Leaves) return ChunkTint::Foliage;
+        if (block_type == BlockType::Grass && face == 2) return ChunkTint::Grass;
+        return ChunkTint::White;
+    };
+
+    // Blocks drawn by the plain cube path below (not markers, vegetation,
+    // fences, slabs or non-full models).
+    const auto is_cube_block = [&ctx](BlockType type) -> bool {
+        if (type == BlockType::Air || type == BlockType::Light) return false;
+        if (shared::voxel::is_vegetation(type) || shared::voxel::is_fence(type) ||
+            shared::voxel::is_slab(type)) {
+            return false;
+        }
+        const auto* model = ctx.model(type);
+        return !(model && model->has_elements() && model->shape != shared::voxel::BlockShape::Full);
+    };
+
+    // One face of a plain cube, w x h blocks along the face's texture u/v
+    // axes (1x1 outside greedy meshing), with per-corner AO.
+    auto add_cube_face = [&](int x, int y, int z, int face, BlockType block_type, int w, int h,
+                             const int corner_ao[4]) {
+        // World axis carrying texture u / v for each face; see face_uvs
+        static const int face_axis_u[6] = {2, 2, 0, 0, 0, 0};
+        static const int face_axis_v[6] = {1, 1, 2, 2, 1, 1};
+
+        float pos[4][3];
+        float uv[4][2];
+        for (int corner = 0; corner < 4; ++corner) {
+            const int v = quad_corner_vertex[corner];
+            float p[3] = {face_vertices[face][v][0], face_vertices[face][v][1], face_vertices[face][v][2]};
+            p[face_axis_u[face]] *= static_cast<float>(w);
+            p[face_axis_v[face]] *= static_cast<float>(h);
+            pos[corner][0] = static_cast<float>(x) + p[0];
+            pos[corner][1] = static_cast<float>(y) + p[1];
+            pos[corner][2] = static_cast<float>(z) + p[2];
+            uv[corner][0] = face_uvs[face][v][0] * static_cast<float>(w);
+            uv[corner][1] = face_uvs[face][v][1] * static_cast<float>(h);
+        }
+
+        const int face_light = in.light(x + face_dir[face][0], y + face_dir[face][1], z + face_dir[face][2]);
+        emit_quad(pos, uv, face, ctx.tile(block_type, face), face_light, corner_ao, cube_tint(block_type, face),
+                  w > 1 || h > 1);
+    };
+
+    // Greedy path: per face direction and slice, merge visible cube faces
+    // with the same block type, light and uniform AO into rectangles. A
+    // merged quad's texcoords count tiles and carry the repeat flag, so the
+    // shader wraps them back into the block's atlas tile. Faces with uneven
+    // AO stay 1x1 so the corner shading is unchanged.
+    auto add_greedy_cube_faces = [&]() {
+        static const int face_axis_u[6] = {2, 2, 0, 0, 0, 0};
+        static const int face_axis_v[6] = {1, 1, 2, 2, 1, 1};
+        static const int axis_extent[3] = {CHUNK_WIDTH, CHUNK_SECTION_HEIGHT, CHUNK_DEPTH};
+        const int axis_origin[3] = {0, base_y, 0};
+
+        constexpr std::uint32_t kCellFace = 0x80000000u;
+        constexpr std::uint32_t kCellSingle = 0x40000000u;
+        std::vector<std::uint32_t> mask(static_cast<std::size_t>(CHUNK_SECTION_HEIGHT) * CHUNK_WIDTH);
+
+        for (int face = 0; face < 6; ++face) {
+            const int axis_n = face_dir[face][0] != 0 ? 0 : (face_dir[face][1] != 0 ? 1 : 2);
+            const int axis_u = face_axis_u[face];
+            const int axis_v = face_axis_v[face];
+            const int size_u = axis_extent[axis_u];
+            const int size_v = axis_extent[axis_v];
+
+            for (int slice = 0; slice < axis_extent[axis_n]; ++slice) {
+                bool any = false;
+                for (int b = 0; b < size_v; ++b) {
+                    for (int a = 0; a < size_u; ++a) {
+                        int p[3];
+                        p[axis_n] = axis_origin[axis_n] + slice;
+                        p[axis_u] = axis_origin[axis_u] + a;
+                        p[axis_v] = axis_origin[axis_v] + b;
+
+                        std::uint32_t cell = 0;
+                        const auto type = static_cast<BlockType>(in.block(p[0], p[1], p[2]));
+                        if (is_cube_block(type) &&
+                            is_transparent(static_cast<BlockType>(in.block(
+                                p[0] + face_dir[face][0], p[1] + face_dir[face][1], p[2] + face_dir[face][2])))) {
+                            int corner_ao[4];
+                            face_corner_ao(p[0], p[1], p[2], face, corner_ao);
+                            const bool uniform_ao = corner_ao[0] == corner_ao[1] &&
+                                                    corner_ao[0] == corner_ao[2] &&
+                                                    corner_ao[0] == corner_ao[3];
+                            const auto light = in.light(p[0] + face_dir[face][0], p[1] + face_dir[face][1],
+                                                        p[2] + face_dir[face][2]);
+                            cell = kCellFace | (uniform_ao ? 0u : kCellSingle) |
+                                   (static_cast<std::uint32_t>(type) << 16) |
+                                   (static_cast<std::uint32_t>(light) << 8) |
+                                   static_cast<std::uint32_t>(corner_ao[0]);
+                            any = true;
+                        }
+                        mask[static_cast<std::size_t>(b * size_u + a)] = cell;
+                    }
+                }
+                if (!any) continue;
+
+                for (int b = 0; b < size_v; ++b) {
+                    for (int a = 0; a < size_u;) {
+                        const std::uint32_t cell = mask[static_cast<std::size_t>(b * size_u + a)];
+                        if (cell == 0) {
+                            ++a;
+                            continue;
+                        }
+
+                        int p[3];
+                        p[axis_n] = axis_origin[axis_n] + slice;
+                        p[axis_u] = axis_origin[axis_u] + a;
+                        p[axis_v] = axis_origin[axis_v] + b;
+                        const auto type = static_cast<BlockType>((cell >> 16) & 0xFFu);
+
+                        int w = 1;
+                        int h = 1;
+                        if (!(cell & kCellSingle)) {
+                            while (a + w < size_u && mask[static_cast<std::size_t>(b * size_u + a + w)] == cell) {
+                                ++w;
+                            }
+                            for (bool grow = true; grow && b + h < size_v;) {
+                                for (int k = 0; k < w; ++k) {
+                                    if (mask[static_cast<std::size_t>((b + h) * size_u + a + k)] != cell) {
+                                        grow = false;
+                                        break;
+                                    }
+                                }
+                                if (grow) ++h;
+                            }
+                        }
+
+                        for (int j = 0; j < h; ++j) {
+                            std::fill_n(&mask[static_cast<std::size_t>((b + j) * size_u + a)], w, 0u);
+                        }
+
+                        int corner_ao[4];
+                        if (cell & kCellSingle) {
+                            face_corner_ao(p[0], p[1], p[2], face, corner_ao);
+                        } else {
+                            std::fill_n(corner_ao, 4, static_cast<int>(cell & 0xFFu));
+                        }
+                        add_cube_face(p[0], p[1], p[2], face, type, w, h, corner_ao);
+                        a += w;
+                    }
+                }
+            }
+        }
+    };
+
+    for (int y = base_y; y < base_y + CHUNK_SECTION_HEIGHT; y++) {
+        for (int z = 0; z < CHUNK_DEPTH; z++) {
+            for (int x = 0; x < CHUNK_WIDTH; x++) {
+                Block block = in.block(x, y, z);
+                if (block == static_cast<Block>(BlockType::Air)) continue;
+
+                auto block_type = static_cast<BlockType>(block);
+
+                if (block_type == BlockType::Light) {
+                    out.light_markers.push_back(rf::Vec3{
+                        origin_x + static_cast<float>(x) + 0.5f,
+                        static_cast<float>(y) + 0.5f,
+                        origin_z + static_cast<float>(z) + 0.5f,
+                    });
+                    continue;
+                }
+
+                // Handle vegetation (cross-shaped blocks like tall grass, flowers)
+                if (shared::voxel::is_vegetation(block_type)) {
+                    // Vegetation uses foliage tint for tall grass, white for flowers
+                    const ChunkTint tint = (block_type == BlockType::TallGrass) ? ChunkTint::Grass : ChunkTint::White;
+                    add_cross_model(x, y, z, block_type, in.light(x, y, z), tint);
+                    continue;
+                }
+
+                const auto* block_model = ctx.model(block_type);
+
+                auto block_state = in.state(x, y, z);
+
+                if (shared::voxel::is_fence(block_type)) {
+                    auto fence_elements = shared::voxel::models::make_fence_elements(
+                        block_state.north, block_state.south,
+                        block_state.east, block_state.west);
+
+                    for (const auto& elem : fence_elements) {
+                        for (int face = 0; face < 6; face++) {
+                            if (!elem.faceEnabled[face]) continue;
+
+                            const int nx = x + face_dir[face][0];
+                            const int ny = y + face_dir[face][1];
+                            const int nz = z + face_dir[face][2];
+
+                            if (elem.faces[face].cullface && should_cull_model_face(nx, ny, nz)) {
+                                continue;
+                            }
+
+                            add_element_face(elem, face, block_type, x, y, z, ChunkTint::White);
+                        }
+                    }
+                    continue;
+                }
+
+                if (shared::voxel::is_slab(block_type)) {
+                    auto slab_elem = shared::voxel::models::make_slab_element(block_state.slabType);
+
+                    for (int face = 0; face < 6; face++) {
+                        if (!slab_elem.faceEnabled[face]) continue;
+
+                        const int nx = x + face_dir[face][0];
+                        const int ny = y + face_dir[face][1];
+                        const int nz = z + face_dir[face][2];
+
+                        if (slab_elem.faces[face].cullface && should_cull_model_face(nx, ny, nz)) {
+                            continue;
+                        }
+
+                        add_element_face(slab_elem, face, block_type, x, y, z, ChunkTint::White);
+                    }
+                    continue;
+                }
+
+                if (block_model && block_model->has_elements() &&
+                    block_model->shape != shared::voxel::BlockShape::Full) {
+
+                    for (const auto& elem : block_model->elements) {
+                        for (int face = 0; face < 6; face++) {
+                            if (!elem.faceEnabled[face]) continue;
+
+                            const int nx = x + face_dir[face][0];
+                            const int ny = y + face_dir[face][1];
+                            const int nz = z + face_dir[face][2];
+
+                            if (elem.faces[face].cullface && should_cull_model_face(nx, ny, nz)) {
+                                continue;
+                            }
+
+                            add_element_face(elem, face, block_type, x, y, z, cube_tint(block_type, face));
+                        }
+                    }
+                } else if (!ctx.greedy_full_faces) {
+                    for (int face = 0; face < 6; face++) {
+                        const int nx = x + face_dir[face][0];
+                        const int ny = y + face_dir[face][1];
+                        const int nz = z + face_dir[face][2];
+
+                        Block neighbor = in.block(nx, ny, nz);
+                        if (!is_transparent(static_cast<BlockType>(neighbor))) continue;
+
+                        int corner_ao[4];
+                        face_corner_ao(x, y, z, face, corner_ao);
+                        add_cube_face(x, y, z, face, block_type, 1, 1, corner_ao);
+                    }
+                }
+            }
+        }
+    }
+
+    if (ctx.greedy_full_faces) {
+        add_greedy_cube_faces();
+    }
+
+    out.build_ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+} // namespace voxel
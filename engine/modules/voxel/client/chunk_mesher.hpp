@@ -0,0 +1,113 @@
+#pragma once
+
+// =============================================================================
+// ChunkMesher - CPU half of chunk meshing (no GL dependency)
+// Builds one 16-block section's vertex arrays from a self-contained snapshot
+// of the section and a one-block border around it, so it can run on a
+// worker thread while the main thread keeps editing the live World.
+// =============================================================================
+
+#include "engine/core/export.hpp"
+#include "block.hpp"
+#include "chunk_vertex.hpp"
+#include "../shared/block_shape.hpp"
+#include "../shared/block_state.hpp"
+#include "engine/core/math_types.hpp"
+
+#include <array>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace voxel {
+
+// ============================================================================
+// ChunkMeshInput - Snapshot of a chunk plus its neighbour border
+// ============================================================================
+
+/// Blocks and skylight for x/z in [-1, 16] and y in [base_y() - 1,
+/// base_y() + 16], i.e. one section with a one-block apron taken from the
+/// sections above and below and the eight neighbouring chunks. Missing
+/// neighbours read as air with full skylight, like World lookups do, and so
+/// do the rows above and below the world.
+struct RAYFLOW_VOXEL_API ChunkMeshInput {
+    static constexpr int kPadWidth = CHUNK_WIDTH + 2;
+    static constexpr int kPadDepth = CHUNK_DEPTH + 2;
+    static constexpr int kPadHeight = CHUNK_SECTION_HEIGHT + 2;
+    static constexpr std::size_t kPadSize =
+        static_cast<std::size_t>(kPadWidth) * kPadDepth * kPadHeight;
+
+    int chunk_x{0};
+    int chunk_z{0};
+    int section{0};
+
+    std::vector<Block> blocks;          // kPadSize, see index()
+    std::vector<std::uint8_t> skylight; // kPadSize, 0..15 (lit by SkylightPropagator)
+    std::unordered_map<int, shared::voxel::BlockRuntimeState> states;  // Chunk index -> state
+
+    /// Size the arrays and fill them as if every neighbour were missing.
+    void reset(int cx, int cz, int section_index);
+
+    int base_y() const { return section * CHUNK_SECTION_HEIGHT; }
+
+    /// Index for section-local coordinates (y relative to base_y()), each
+    /// allowed one block out of range.
+    static std::size_t index(int x, int local_y, int z) {
+        return (static_cast<std::size_t>(local_y + 1) * kPadDepth + static_cast<std::size_t>(z + 1)) * kPadWidth +
+               static_cast<std::size_t>(x + 1);
+    }
+
+    // Chunk-local coordinates, like the mesher uses
+    Block block(int x, int y, int z) const { return blocks[index(x, y - base_y(), z)]; }
+    std::uint8_t light(int x, int y, int z) const { return skylight[index(x, y - base_y(), z)]; }
+    shared::voxel::BlockRuntimeState state(int x, int y, int z) const;
+};
+
+// ============================================================================
+// ChunkMeshContext - Read-only renderer state the mesher needs
+// ============================================================================
+
+/// Captured on the main thread (atlas tiles, block models) so
+/// workers never touch the BlockRegistry or GL objects.
+struct RAYFLOW_VOXEL_API ChunkMeshContext {
+    static constexpr std::size_t kBlockTypes = static_cast<std::size_t>(BlockType::Count);
+
+    /// Merge coplanar full-cube faces into larger quads whose texture repeats
+    /// per block (PackedChunkVertex repeat bit).
+    bool greedy_full_faces{false};
+
+    std::array<std::array<std::uint16_t, 6>, kBlockTypes> tile_ids{};  // Atlas tile per block type and face
+    std::array<const shared::voxel::BlockModel*, kBlockTypes> models{};  // nullptr = plain cube
+
+    int tile(BlockType type, int face) const {
+        return tile_ids[static_cast<std::size_t>(type)][static_cast<std::size_t>(face)];
+    }
+    const shared::voxel::BlockModel* model(BlockType type) const {
+        return models[static_cast<std::size_t>(type)];
+    }
+};
+
+// ============================================================================
+// ChunkMeshData - Output of one mesh build
+// ============================================================================
+
+/// Packed quads (4 vertices each, drawn with the shared quad index buffer).
+/// Reused between builds to keep vector capacity.
+struct RAYFLOW_VOXEL_API ChunkMeshData {
+    std::vector<PackedChunkVertex> vertices;  // Chunk-local, see chunk_vertex.hpp
+    std::vector<rf::Vec3> light_markers;
+
+    bool empty{false};                 // Section is all air (no mesh built)
+    float build_ms{0.0f};
+
+    int vertex_count() const { return static_cast<int>(vertices.size()); }
+    int quad_count() const { return static_cast<int>(vertices.size() / 4); }
+    void clear();
+};
+
+/// Build the mesh of input's section into out (chunk-local positions).
+/// Thread-safe for distinct inputs/outputs sharing one context.
+RAYFLOW_VOXEL_API void build_chunk_mesh(const ChunkMeshInput& input, const ChunkMeshContext& ctx,
+                                        ChunkMeshData& out);
+
+} // namespace voxel
@@ -0,0 +1,103 @@
+#pragma once
+
+// =============================================================================
+// ChunkVertex - Packed 16-byte chunk vertex (no GL dependency)
+// Chunk meshes are lists of quads, 4 vertices each, drawn through a shared
+// quad index buffer. Positions are chunk-local fixed point; the normal,
+// skylight, AO and tint are small indices the voxel shaders expand.
+// =============================================================================
+
+#include "engine/core/math_types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace voxel {
+
+/// Tint applied to a face; the colours themselves are shader uniforms.
+/// Anything but White also marks the face as foliage.
+enum class ChunkTint : std::uint8_t {
+    White = 0,
+    Grass = 1,
+    Foliage = 2,
+};
+
+/// Layout shared with shaders/voxel.vs and shaders/shadow.vs.
+struct PackedChunkVertex {
+    std::uint16_t x{0};      // Chunk-local position, kPositionScale steps per block
+    std::uint16_t y{0};
+    std::uint16_t z{0};
+    std::uint8_t face{0};    // Bits 0-3 normal index, bit 4 repeat texture across the quad
+    std::uint8_t shade{0};   // Bits 0-3 skylight, bits 4-5 AO level, bits 6-7 ChunkTint
+    std::uint16_t u{0};      // Texcoord inside the atlas tile, kTexcoordScale steps per tile
+    std::uint16_t v{0};
+    std::uint16_t tile{0};   // Atlas tile index (row-major)
+    std::uint16_t reserved{0};
+};
+static_assert(sizeof(PackedChunkVertex) == 16, "PackedChunkVertex must stay 16 bytes");
+
+/// Unpacked form, for building and inspecting meshes on the CPU.
+struct ChunkVertex {
+    rf::Vec3 position{0.0f};  // Chunk-local
+    rf::Vec2 uv{0.0f};        // Tile units; 0..1 spans one tile
+    int normal{0};            // See chunk_normal()
+    bool repeat{false};       // Wrap uv into the tile (greedy quads span several tiles)
+    int light{15};            // Skylight 0..15
+    int ao{3};                // Index into kChunkAoLevels
+    ChunkTint tint{ChunkTint::White};
+    int tile{0};
+};
+
+constexpr float kPositionScale = 128.0f;  // 1/128 block; y = 256 still fits in 16 bits
+constexpr float kTexcoordScale = 16.0f;   // One atlas pixel of a 16px tile
+constexpr int kChunkNormalCount = 10;
+constexpr float kChunkAoLevels[4] = {0.2f, 0.5f, 0.75f, 1.0f};
+
+/// Normal indices 0-5 are the cube faces (+X, -X, +Y, -Y, +Z, -Z); 6-9 are
+/// the diagonal planes of cross-shaped vegetation.
+inline rf::Vec3 chunk_normal(int index) {
+    static const rf::Vec3 normals[kChunkNormalCount] = {
+        {1.0f, 0.0f, 0.0f}, {-1.0f, 0.0f, 0.0f},
+        {0.0f, 1.0f, 0.0f}, {0.0f, -1.0f, 0.0f},
+        {0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, -1.0f},
+        {-0.707f, 0.0f, 0.707f}, {0.707f, 0.0f, -0.707f},
+        {0.707f, 0.0f, 0.707f}, {-0.707f, 0.0f, -0.707f},
+    };
+    return normals[std::clamp(index, 0, kChunkNormalCount - 1)];
+}
+
+inline std::uint16_t pack_chunk_unit(float value, float scale) {
+    const float scaled = std::round(value * scale);
+    return static_cast<std::uint16_t>(std::clamp(scaled, 0.0f, 65535.0f));
+}
+
+inline PackedChunkVertex encode_chunk_vertex(const ChunkVertex& in) {
+    PackedChunkVertex out;
+    out.x = pack_chunk_unit(in.position.x, kPositionScale);
+    out.y = pack_chunk_unit(in.position.y, kPositionScale);
+    out.z = pack_chunk_unit(in.position.z, kPositionScale);
+    out.face = static_cast<std::uint8_t>((in.normal & 0x0F) | (in.repeat ? 0x10 : 0));
+    out.shade = static_cast<std::uint8_t>((in.light & 0x0F) | ((in.ao & 0x03) << 4) |
+                                          ((static_cast<int>(in.tint) & 0x03) << 6));
+    out.u = pack_chunk_unit(in.uv.x, kTexcoordScale);
+    out.v = pack_chunk_unit(in.uv.y, kTexcoordScale);
+    out.tile = static_cast<std::uint16_t>(in.tile);
+    return out;
+}
+
+inline ChunkVertex decode_chunk_vertex(const PackedChunkVertex& in) {
+    ChunkVertex out;
+    out.position = rf::Vec3{static_cast<float>(in.x), static_cast<float>(in.y), static_cast<float>(in.z)} *
+                   (1.0f / kPositionScale);
+    out.uv = rf::Vec2{static_cast<float>(in.u), static_cast<float>(in.v)} * (1.0f / kTexcoordScale);
+    out.normal = in.face & 0x0F;
+    out.repeat = (in.face & 0x10) != 0;
+    out.light = in.shade & 0x0F;
+    out.ao = (in.shade >> 4) & 0x03;
+    out.tint = static_cast<ChunkTint>((in.shade >> 6) & 0x03);
+    out.tile = in.tile;
+    return out;
+}
+
+} // namespace voxel
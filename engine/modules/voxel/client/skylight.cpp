@@ -0,0 +1,389 @@
+#include "skylight.hpp"
+
+#include <algorithm>
+
+namespace voxel {
+
+namespace {
+
+constexpr int kDx[6] = {1, -1, 0, 0, 0, 0};
+constexpr int kDy[6] = {0, 0, 1, -1, 0, 0};
+constexpr int kDz[6] = {0, 0, 0, 0, 1, -1};
+
+// Light entering a chunk from an unloaded neighbour (open air at 15)
+constexpr std::uint8_t kUnloadedBorderLight = 13;
+
+bool blocks_light(Block block) {
+    const auto type = static_cast<BlockType>(block);
+    return is_solid(type) && !is_transparent(type);
+}
+
+bool dims_light(Block block) {
+    const auto type = static_cast<BlockType>(block);
+    return type == BlockType::Leaves || type == BlockType::Water;
+}
+
+// Sunlight one cell further down a column, given the value above it
+std::uint8_t column_step(std::uint8_t above, Block block) {
+    if (blocks_light(block)) return 0;
+    if (dims_light(block)) return above > 0 ? static_cast<std::uint8_t>(above - 1) : 0;
+    return above;
+}
+
+// Sections whose meshes read a cell at height y: its own, and the
+// neighbouring one when y is on a section boundary
+std::uint16_t sections_reading(int y) {
+    const int section = y / CHUNK_SECTION_HEIGHT;
+    auto mask = static_cast<std::uint16_t>(1u << section);
+    if (y % CHUNK_SECTION_HEIGHT == 0 && section > 0) mask |= static_cast<std::uint16_t>(1u << (section - 1));
+    if (y % CHUNK_SECTION_HEIGHT == CHUNK_SECTION_HEIGHT - 1 && section < CHUNK_SECTIONS - 1) {
+        mask |= static_cast<std::uint16_t>(1u << (section + 1));
+    }
+    return mask;
+}
+
+int floor_div(int value, int size) {
+    return value >= 0 ? value / size : (value - size + 1) / size;
+}
+
+std::size_t chunk_index(int lx, int y, int lz) {
+    return static_cast<std::size_t>(y) * CHUNK_WIDTH * CHUNK_DEPTH + static_cast<std::size_t>(lz) * CHUNK_WIDTH +
+           static_cast<std::size_t>(lx);
+}
+
+} // namespace
+
+bool SkylightPropagator::locate(int x, int y, int z, Cell& out) {
+    if (y < 0 || y >= CHUNK_HEIGHT) return false;
+
+    const int cx = floor_div(x, CHUNK_WIDTH);
+    const int cz = floor_div(z, CHUNK_DEPTH);
+    if (!cache_valid_ || cx != cached_cx_ || cz != cached_cz_) {
+        cached_ = access_.chunk(cx, cz);
+        cached_cx_ = cx;
+        cached_cz_ = cz;
+        cache_valid_ = true;
+    }
+    if (!cached_.blocks) return false;
+
+    out.chunk = cached_;
+    out.cx = cx;
+    out.cz = cz;
+    out.index = chunk_index(x - cx * CHUNK_WIDTH, y, z - cz * CHUNK_DEPTH);
+    return true;
+}
+
+std::uint8_t SkylightPropagator::source(int x, int y, int z, const Cell& cell) {
+    const Block* blocks = cell.chunk.blocks;
+    if (blocks_light(blocks[cell.index])) return 0;
+
+    // Column value: full sun dimmed by leaves/water above, none under a roof
+    int light = 15;
+    const auto top = static_cast<std::size_t>(cell.chunk.height) * CHUNK_WIDTH * CHUNK_DEPTH;
+    for (std::size_t i = cell.index; i < top; i += CHUNK_WIDTH * CHUNK_DEPTH) {
+        if (blocks_light(blocks[i])) {
+            light = 0;
+            break;
+        }
+        if (dims_light(blocks[i]) && light > 0) --light;
+    }
+    if (light >= kUnloadedBorderLight) return static_cast<std::uint8_t>(light);
+
+    const int lx = x - cell.cx * CHUNK_WIDTH;
+    const int lz = z - cell.cz * CHUNK_DEPTH;
+    if (lx == 0 || lx == CHUNK_WIDTH - 1 || lz == 0 || lz == CHUNK_DEPTH - 1) {
+        for (int dir = 0; dir < 6; ++dir) {
+            if (kDy[dir] != 0) continue;
+            Cell neighbor;
+            if (!locate(x + kDx[dir], y, z + kDz[dir], neighbor)) {
+                return kUnloadedBorderLight;
+            }
+        }
+    }
+    return static_cast<std::uint8_t>(light);
+}
+
+void SkylightPropagator::write(const Cell& cell, int x, int z, std::uint8_t value) {
+    cell.chunk.light->set(cell.index, value);
+    ++visited_;
+
+    const int lx = x - cell.cx * CHUNK_WIDTH;
+    const int lz = z - cell.cz * CHUNK_DEPTH;
+    std::uint8_t borders = 0;
+    if (lx == 0) borders |= SkylightChange::NegX;
+    if (lx == CHUNK_WIDTH - 1) borders |= SkylightChange::PosX;
+    if (lz == 0) borders |= SkylightChange::NegZ;
+    if (lz == CHUNK_DEPTH - 1) borders |= SkylightChange::PosZ;
+    const std::uint16_t sections = sections_reading(static_cast<int>(cell.index / (CHUNK_WIDTH * CHUNK_DEPTH)));
+
+    for (auto it = changes_.rbegin(); it != changes_.rend(); ++it) {
+        if (it->cx == cell.cx && it->cz == cell.cz) {
+            it->borders |= borders;
+            it->sections |= sections;
+            return;
+        }
+    }
+    changes_.push_back({cell.cx, cell.cz, borders, sections});
+}
+
+// Removal BFS: darken every cell that may have taken its light from a
+// removed one (anything dimmer than it), queue brighter neighbours to
+// spread back in, then re-seed the darkened cells from their own sources.
+void SkylightPropagator::remove_light() {
+    for (std::size_t head = 0; head < remove_queue_.size(); ++head) {
+        const Node node = remove_queue_[head];
+        for (int dir = 0; dir < 6; ++dir) {
+            const int nx = node.x + kDx[dir];
+            const int ny = node.y + kDy[dir];
+            const int nz = node.z + kDz[dir];
+            Cell cell;
+            if (!locate(nx, ny, nz, cell)) continue;
+
+            const std::uint8_t light = cell.chunk.light->get(cell.index);
+            if (light == 0) continue;
+            if (light < node.light) {
+                write(cell, nx, nz, 0);
+                remove_queue_.push_back({nx, ny, nz, light});
+                removed_.push_back({nx, ny, nz, 0});
+            } else {
+                add_queue_.push_back({nx, ny, nz, light});
+            }
+        }
+    }
+    remove_queue_.clear();
+
+    for (const Node& node : removed_) {
+        Cell cell;
+        if (!locate(node.x, node.y, node.z, cell)) continue;
+        const std::uint8_t light = source(node.x, node.y, node.z, cell);
+        if (light > cell.chunk.light->get(cell.index)) {
+            write(cell, node.x, node.z, light);
+            add_queue_.push_back({node.x, node.y, node.z, light});
+        }
+    }
+    removed_.clear();
+}
+
+// Add BFS: spread queued light into open neighbours that are darker than
+// it would make them. Entries that no longer match their cell are stale.
+void SkylightPropagator::add_light() {
+    for (std::size_t head = 0; head < add_queue_.size(); ++head) {
+        const Node node = add_queue_[head];
+        Cell self;
+        if (!locate(node.x, node.y, node.z, self) || self.chunk.light->get(self.index) != node.light) continue;
+
+        for (int dir = 0; dir < 6; ++dir) {
+            const std::uint8_t decay = kDy[dir] == 1 ? 1 : 2;
+            if (node.light <= decay) continue;
+
+            const int nx = node.x + kDx[dir];
+            const int ny = node.y + kDy[dir];
+            const int nz = node.z + kDz[dir];
+            Cell cell;
+            if (!locate(nx, ny, nz, cell) || blocks_light(cell.chunk.blocks[cell.index])) continue;
+
+            const auto light = static_cast<std::uint8_t>(node.light - decay);
+            if (light > cell.chunk.light->get(cell.index)) {
+                write(cell, nx, nz, light);
+                add_queue_.push_back({nx, ny, nz, light});
+            }
+        }
+    }
+    add_queue_.clear();
+}
+
+void SkylightPropagator::chunks_loaded(const std::vector<std::pair<int, int>>& chunks) {
+    cache_valid_ = false;
+    visited_ = 0;
+
+    const auto is_new = [&chunks](int cx, int cz) {
+        return std::find(chunks.begin(), chunks.end(), std::make_pair(cx, cz)) != chunks.end();
+    };
+
+    // Old light in the new chunks is meaningless; neighbours' border cells
+    // may have lit from it (or from open sky there), so darken those too.
+    for (const auto& [cx, cz] : chunks) {
+        const SkylightChunk chunk = access_.chunk(cx, cz);
+        if (!chunk.blocks) continue;
+        chunk.light->fill(0);
+        changes_.push_back({cx, cz,
+                            SkylightChange::NegX | SkylightChange::PosX | SkylightChange::NegZ | SkylightChange::PosZ,
+                            static_cast<std::uint16_t>((1u << CHUNK_SECTIONS) - 1)});
+
+        for (int dir = 0; dir < 6; ++dir) {
+            if (kDy[dir] != 0 || is_new(cx + kDx[dir], cz + kDz[dir])) continue;
+
+            // The neighbour's row of cells touching this chunk
+            const int x0 = kDx[dir] > 0 ? (cx + 1) * CHUNK_WIDTH : (kDx[dir] < 0 ? cx * CHUNK_WIDTH - 1 : cx * CHUNK_WIDTH);
+            const int z0 = kDz[dir] > 0 ? (cz + 1) * CHUNK_DEPTH : (kDz[dir] < 0 ? cz * CHUNK_DEPTH - 1 : cz * CHUNK_DEPTH);
+            const int run = kDx[dir] != 0 ? CHUNK_DEPTH : CHUNK_WIDTH;
+            for (int y = 0; y < CHUNK_HEIGHT; ++y) {
+                for (int i = 0; i < run; ++i) {
+                    const int x = kDx[dir] != 0 ? x0 : x0 + i;
+                    const int z = kDx[dir] != 0 ? z0 + i : z0;
+                    Cell cell;
+                    if (!locate(x, y, z, cell)) break;
+                    const std::uint8_t light = cell.chunk.light->get(cell.index);
+                    if (light == 0) continue;
+                    write(cell, x, z, 0);
+                    remove_queue_.push_back({x, y, z, light});
+                    removed_.push_back({x, y, z, 0});
+                }
+            }
+        }
+    }
+    remove_light();
+
+    // Sunlit columns of the new chunks, plus open sky beyond unloaded borders
+    for (const auto& [cx, cz] : chunks) {
+        const SkylightChunk chunk = access_.chunk(cx, cz);
+        if (!chunk.blocks) continue;
+
+        const bool open_negx = !access_.chunk(cx - 1, cz).blocks;
+        const bool open_posx = !access_.chunk(cx + 1, cz).blocks;
+        const bool open_negz = !access_.chunk(cx, cz - 1).blocks;
+        const bool open_posz = !access_.chunk(cx, cz + 1).blocks;
+
+        // Empty sections on top are open sky: full light, nothing to walk
+        const int height = std::clamp(chunk.height, 0, CHUNK_HEIGHT);
+        if (height < CHUNK_HEIGHT) {
+            chunk.light->fill(chunk_index(0, height, 0), CHUNK_SIZE, 15);
+            visited_ += static_cast<std::size_t>(CHUNK_HEIGHT - height) * CHUNK_WIDTH * CHUNK_DEPTH;
+        }
+
+        for (int lz = 0; lz < CHUNK_DEPTH; ++lz) {
+            for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+                const bool open_border = (lx == 0 && open_negx) || (lx == CHUNK_WIDTH - 1 && open_posx) ||
+                                         (lz == 0 && open_negz) || (lz == CHUNK_DEPTH - 1 && open_posz);
+                std::uint8_t column = 15;
+                for (int y = height - 1; y >= 0; --y) {
+                    const std::size_t index = chunk_index(lx, y, lz);
+                    const Block block = chunk.blocks[index];
+                    column = column_step(column, block);
+
+                    std::uint8_t light = column;
+                    if (open_border && !blocks_light(block)) light = std::max(light, kUnloadedBorderLight);
+                    if (light == 0) continue;
+
+                    chunk.light->set(index, light);
+                    ++visited_;
+                }
+            }
+        }
+
+        // Only cells that can brighten a neighbour start the flood fill; open
+        // sky over open sky would otherwise queue most of the chunk. Above
+        // the first open-sky row only light leaving the chunk matters.
+        for (int y = 0; y < CHUNK_HEIGHT; ++y) {
+            for (int lz = 0; lz < CHUNK_DEPTH; ++lz) {
+                for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+                    const bool border = lx == 0 || lx == CHUNK_WIDTH - 1 || lz == 0 || lz == CHUNK_DEPTH - 1;
+                    if (y > height && !border) continue;
+
+                    const std::size_t index = chunk_index(lx, y, lz);
+                    const std::uint8_t light = chunk.light->get(index);
+                    if (light <= 1) continue;
+
+                    bool spreads = border;
+                    for (int dir = 0; dir < 6 && !spreads; ++dir) {
+                        const int ny = y + kDy[dir];
+                        if (ny < 0 || ny >= CHUNK_HEIGHT) continue;
+                        const std::size_t neighbor = chunk_index(lx + kDx[dir], ny, lz + kDz[dir]);
+                        const int decay = kDy[dir] == 1 ? 1 : 2;
+                        spreads = !blocks_light(chunk.blocks[neighbor]) && light - decay > chunk.light->get(neighbor);
+                    }
+                    if (spreads) {
+                        add_queue_.push_back({cx * CHUNK_WIDTH + lx, y, cz * CHUNK_DEPTH + lz, light});
+                    }
+                }
+            }
+        }
+    }
+    cache_valid_ = false;
+    add_light();
+}
+
+void SkylightPropagator::chunk_unloaded(int cx, int cz) {
+    cache_valid_ = false;
+    visited_ = 0;
+
+    for (int dir = 0; dir < 6; ++dir) {
+        if (kDy[dir] != 0) continue;
+
+        const int x0 = kDx[dir] > 0 ? (cx + 1) * CHUNK_WIDTH : (kDx[dir] < 0 ? cx * CHUNK_WIDTH - 1 : cx * CHUNK_WIDTH);
+        const int z0 = kDz[dir] > 0 ? (cz + 1) * CHUNK_DEPTH : (kDz[dir] < 0 ? cz * CHUNK_DEPTH - 1 : cz * CHUNK_DEPTH);
+        const int run = kDx[dir] != 0 ? CHUNK_DEPTH : CHUNK_WIDTH;
+        for (int y = 0; y < CHUNK_HEIGHT; ++y) {
+            for (int i = 0; i < run; ++i) {
+                const int x = kDx[dir] != 0 ? x0 : x0 + i;
+                const int z = kDx[dir] != 0 ? z0 + i : z0;
+                Cell cell;
+                if (!locate(x, y, z, cell)) break;
+                if (blocks_light(cell.chunk.blocks[cell.index]) ||
+                    cell.chunk.light->get(cell.index) >= kUnloadedBorderLight) {
+                    continue;
+                }
+                write(cell, x, z, kUnloadedBorderLight);
+                add_queue_.push_back({x, y, z, kUnloadedBorderLight});
+            }
+        }
+    }
+    add_light();
+}
+
+void SkylightPropagator::block_changed(int x, int y, int z, Block old) {
+    cache_valid_ = false;
+    visited_ = 0;
+
+    Cell changed;
+    if (!locate(x, y, z, changed)) return;
+    const Block now = changed.chunk.blocks[changed.index];
+    if (blocks_light(now) == blocks_light(old) && dims_light(now) == dims_light(old)) return;
+
+    const auto seed = [this](int sx, int sy, int sz) {
+        Cell cell;
+        if (!locate(sx, sy, sz, cell)) return;
+        const std::uint8_t light = cell.chunk.light->get(cell.index);
+        if (light > 0) {
+            write(cell, sx, sz, 0);
+            remove_queue_.push_back({sx, sy, sz, light});
+        }
+        removed_.push_back({sx, sy, sz, 0});
+    };
+
+    // The edited cell, and every cell below it whose column value changed
+    seed(x, y, z);
+
+    std::uint8_t above = 15;
+    for (int cy = std::min(changed.chunk.height, CHUNK_HEIGHT) - 1; cy > y; --cy) {
+        const std::size_t i = changed.index + static_cast<std::size_t>(cy - y) * CHUNK_WIDTH * CHUNK_DEPTH;
+        above = column_step(above, changed.chunk.blocks[i]);
+    }
+    std::uint8_t column_old = column_step(above, old);
+    std::uint8_t column_new = column_step(above, now);
+    for (int cy = y - 1; cy >= 0 && column_old != column_new; --cy) {
+        const Block block = changed.chunk.blocks[changed.index - static_cast<std::size_t>(y - cy) * CHUNK_WIDTH * CHUNK_DEPTH];
+        column_old = column_step(column_old, block);
+        column_new = column_step(column_new, block);
+        if (column_old != column_new) seed(x, cy, z);
+    }
+
+    remove_light();
+
+    // An opened cell takes light from whatever surrounds it
+    for (int dir = 0; dir < 6; ++dir) {
+        Cell cell;
+        if (!locate(x + kDx[dir], y + kDy[dir], z + kDz[dir], cell)) continue;
+        const std::uint8_t light = cell.chunk.light->get(cell.index);
+        if (light > 1) add_queue_.push_back({x + kDx[dir], y + kDy[dir], z + kDz[dir], light});
+    }
+    add_light();
+}
+
+std::vector<SkylightChange> SkylightPropagator::take_changes() {
+    std::vector<SkylightChange> out;
+    out.swap(changes_);
+    return out;
+}
+
+} // namespace voxel
@@ -0,0 +1,147 @@
+#pragma once
+
+// =============================================================================
+// Skylight - Packed light storage and incremental propagation (no GL dependency)
+// Light is a 0..15 nibble per cell. Each cell's source is its sunlit column
+// value; light spreads to open neighbours losing 1 going up and 2 otherwise.
+// Block edits relight only the region they affect, across chunk borders, and
+// give the same result as lighting every loaded chunk from scratch.
+// =============================================================================
+
+#include "engine/core/export.hpp"
+#include "block.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace voxel {
+
+/// One chunk of skylight, two cells per byte (Chunk layout: y*256 + z*16 + x).
+class LightNibbles {
+public:
+    std::uint8_t get(std::size_t index) const {
+        const std::uint8_t byte = data_[index >> 1];
+        return (index & 1) ? static_cast<std::uint8_t>(byte >> 4) : static_cast<std::uint8_t>(byte & 0x0F);
+    }
+
+    void set(std::size_t index, std::uint8_t value) {
+        std::uint8_t& byte = data_[index >> 1];
+        byte = (index & 1) ? static_cast<std::uint8_t>((byte & 0x0F) | (value << 4))
+                           : static_cast<std::uint8_t>((byte & 0xF0) | (value & 0x0F));
+    }
+
+    void fill(std::uint8_t value) { fill(0, data_.size() * 2, value); }
+
+    /// Fill cells [begin, end); both must be even.
+    void fill(std::size_t begin, std::size_t end, std::uint8_t value) {
+        std::fill(data_.begin() + static_cast<std::ptrdiff_t>(begin / 2),
+                  data_.begin() + static_cast<std::ptrdiff_t>(end / 2),
+                  static_cast<std::uint8_t>((value & 0x0F) | (value << 4)));
+    }
+
+    /// Unpack count cells starting at index into one byte each.
+    void unpack(std::size_t index, std::size_t count, std::uint8_t* out) const {
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = get(index + i);
+        }
+    }
+
+    bool operator==(const LightNibbles& other) const { return data_ == other.data_; }
+
+private:
+    std::array<std::uint8_t, CHUNK_SIZE / 2> data_{};
+};
+
+/// Blocks and light of one loaded chunk; blocks == nullptr means not loaded.
+/// Every cell at or above height is air (whole sections of open sky are
+/// lit without being walked).
+struct SkylightChunk {
+    const Block* blocks{nullptr};
+    LightNibbles* light{nullptr};
+    int height{CHUNK_HEIGHT};
+};
+
+/// How the propagator reaches chunks. Unloaded chunks read as open air at
+/// full skylight and are never written.
+class SkylightAccess {
+public:
+    virtual ~SkylightAccess() = default;
+    virtual SkylightChunk chunk(int cx, int cz) = 0;
+};
+
+/// A chunk whose light changed; border bits say which face neighbours
+/// read changed cells through their mesh apron, and section bits which
+/// sections' meshes (bit n = section n) read them at all.
+struct SkylightChange {
+    enum Border : std::uint8_t {
+        NegX = 1 << 0,
+        PosX = 1 << 1,
+        NegZ = 1 << 2,
+        PosZ = 1 << 3,
+    };
+
+    int cx{0};
+    int cz{0};
+    std::uint8_t borders{0};
+    std::uint16_t sections{0};
+};
+
+class RAYFLOW_VOXEL_API SkylightPropagator {
+public:
+    explicit SkylightPropagator(SkylightAccess& access) : access_(access) {}
+
+    /// Light chunks that were just loaded or had their blocks replaced, and
+    /// relight the loaded neighbours that lit from what was there before.
+    /// Passing every loaded chunk is a full recompute.
+    void chunks_loaded(const std::vector<std::pair<int, int>>& chunks);
+
+    /// A chunk was removed; its neighbours now see open sky across the border.
+    void chunk_unloaded(int cx, int cz);
+
+    /// The block at world (x, y, z) was replaced; old is what was there.
+    void block_changed(int x, int y, int z, Block old);
+
+    /// Chunks touched since the last take_changes().
+    std::vector<SkylightChange> take_changes();
+
+    /// Cells written by the last call (work done, for profiling).
+    std::size_t cells_visited() const { return visited_; }
+
+private:
+    struct Node {
+        int x, y, z;
+        std::uint8_t light;
+    };
+
+    struct Cell {
+        SkylightChunk chunk;
+        int cx, cz;
+        std::size_t index;
+    };
+
+    bool locate(int x, int y, int z, Cell& out);
+    std::uint8_t source(int x, int y, int z, const Cell& cell);
+    void write(const Cell& cell, int x, int z, std::uint8_t value);
+    void remove_light();
+    void add_light();
+
+    SkylightAccess& access_;
+
+    // Single-entry cache: BFS neighbours are almost always in the same chunk
+    int cached_cx_{0};
+    int cached_cz_{0};
+    SkylightChunk cached_{};
+    bool cache_valid_{false};
+
+    std::vector<Node> remove_queue_;
+    std::vector<Node> add_queue_;
+    std::vector<Node> removed_;
+    std::vector<SkylightChange> changes_;
+    std::size_t visited_{0};
+};
+
+} // namespace voxel
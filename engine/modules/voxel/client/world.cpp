@@ -1,5 +1,7 @@
 #include "world.hpp"
 #include "block_registry.hpp"
+#include "block_model_loader.hpp"
+#include "engine/client/core/config.hpp"
 #include "engine/client/core/resources.hpp"
 #include "engine/core/logging.hpp"
 #include "engine/core/math_types.hpp"
@@ -18,6 +20,14 @@ namespace {
 
 constexpr int CHUNK_UNLOAD_DISTANCE = 12;
 
+// Snapshots waiting for or inside a worker, plus finished meshes not yet
+// uploaded. Bounds memory held by mesh jobs during a big map load.
+constexpr std::size_t kMaxMeshJobsInFlight = 16;
+
+// Main-thread time per frame for GPU uploads (and for building meshes when
+// there are no worker threads).
+constexpr float kMeshBudgetMs = 4.0f;
+
 float lerp(float a, float b, float t) {
     return a + t * (b - a);
 }
@@ -42,6 +52,8 @@ int floor_div_int(int a, int b) {
 } // anonymous namespace
 
 World::World(unsigned int seed) : seed_(seed) {
+    mesh_workers_ = std::make_unique<ChunkMeshWorkers>(ChunkMeshWorkers::default_thread_count(),
+                                                       kMaxMeshJobsInFlight);
     init_perlin();
     load_voxel_shader();
     TraceLog(LOG_INFO, "World created with seed: %u (infinite chunk generation enabled)", seed);
@@ -52,14 +64,18 @@ World::~World() {
     TraceLog(LOG_INFO, "World destroyed. Total chunks generated: %zu", chunks_.size());
 }
 
-void World::set_map_template(shared::maps::MapTemplate map) {
+void World::set_map_template(shared::maps::SharedMapTemplate map) {
     map_template_ = std::move(map);
+    dirty_chunks_.clear();
+    unlit_chunks_.clear();
     chunks_.clear();
     extract_lights_from_map();
 }
 
 void World::clear_map_template() {
     map_template_.reset();
+    dirty_chunks_.clear();
+    unlit_chunks_.clear();
     chunks_.clear();
     static_lights_.clear();
 }
@@ -68,7 +84,7 @@ float World::temperature() const {
     if (temperature_override_.has_value()) {
         return std::clamp(*temperature_override_, 0.0f, 1.0f);
     }
-    if (map_template_.has_value()) {
+    if (map_template_) {
         return std::clamp(map_template_->visualSettings.temperature, 0.0f, 1.0f);
     }
     return 0.5f;
@@ -86,7 +102,7 @@ float World::humidity() const {
     if (humidity_override_.has_value()) {
         return std::clamp(*humidity_override_, 0.0f, 1.0f);
     }
-    if (map_template_.has_value()) {
+    if (map_template_) {
         return std::clamp(map_template_->visualSettings.humidity, 0.0f, 1.0f);
     }
     return 1.0f;
@@ -199,14 +215,16 @@ void World::set_block(int x, int y, int z, Block type) {
     int local_x = x - chunk_x * CHUNK_WIDTH;
     int local_z = z - chunk_z * CHUNK_DEPTH;
 
+    const Block old = chunk->get_block(local_x, y, local_z);
     chunk->set_block(local_x, y, local_z, type);
+    relight_block(x, y, z, old);
 
     // If we edited a block on a chunk edge, the adjacent chunk's mesh must be rebuilt
     // too, otherwise the newly-exposed (or newly-hidden) neighbor face can be missing.
-    auto mark_chunk_dirty = [this](int cx, int cz) {
+    auto mark_chunk_dirty = [this, y](int cx, int cz) {
         auto it2 = chunks_.find({cx, cz});
         if (it2 != chunks_.end()) {
-            it2->second->mark_dirty();
+            it2->second->mark_dirty(Chunk::sections_touching(y));
         }
     };
 
@@ -269,13 +287,15 @@ void World::set_block_with_state(int x, int y, int z, Block type, shared::voxel:
     int local_x = x - chunk_x * CHUNK_WIDTH;
     int local_z = z - chunk_z * CHUNK_DEPTH;
     
+    const Block old = it->second->get_block(local_x, y, local_z);
     it->second->set_block_with_state(local_x, y, local_z, type, state);
+    relight_block(x, y, z, old);
 
     // If we edited a block on a chunk edge, the adjacent chunk's mesh must be rebuilt
-    auto mark_chunk_dirty = [this](int cx, int cz) {
+    auto mark_chunk_dirty = [this, y](int cx, int cz) {
         auto it2 = chunks_.find({cx, cz});
         if (it2 != chunks_.end()) {
-            it2->second->mark_dirty();
+            it2->second->mark_dirty(Chunk::sections_touching(y));
         }
     };
 
@@ -318,6 +338,7 @@ Chunk* World::get_or_create_chunk(int chunk_x, int chunk_z) {
     });
     
     chunks_[key] = std::move(chunk);
+    queue_chunk_light(chunk_x, chunk_z);
     
     recompute_chunk_states(chunk_x, chunk_z);
     
@@ -373,6 +394,7 @@ void World::apply_chunk_data(int chunkX, int chunkZ, const std::vector<std::uint
     
     chunk->set_generated(true);
     chunk->mark_dirty();
+    queue_chunk_light(chunkX, chunkZ);
     
     auto mark_neighbor = [this](int cx, int cz) {
         auto neighborIt = chunks_.find({cx, cz});
@@ -555,42 +577,213 @@ void World::generate_chunk_terrain(Chunk& chunk) {
 void World::update(const rf::Vec3& player_position) {
     load_chunks_around_player(player_position);
     unload_distant_chunks(player_position);
+    light_queued_chunks();
+    
+    // Meshing runs off the main thread; only snapshots and GL uploads stay here.
+    // Results that are not uploaded this frame wait in the completion queue.
+    schedule_mesh_jobs();
+    upload_finished_meshes();
+    
+    last_player_position_ = player_position;
+}
+
+void World::capture_mesh_input(const Chunk& chunk, int section, ChunkMeshInput& out) const {
+    const int cx = chunk.get_chunk_x();
+    const int cz = chunk.get_chunk_z();
+    out.reset(cx, cz, section);
+    chunk.copy_to_mesh_input(out);
+    
+    auto copy_border = [&](int dcx, int dcz) {
+        auto it = chunks_.find({cx + dcx, cz + dcz});
+        if (it == chunks_.end()) return;  // Missing: stays air with full skylight
+        
+        // The neighbour's row/column touching this chunk, shifted into the apron
+        const int x0 = dcx < 0 ? CHUNK_WIDTH - 1 : 0;
+        const int x1 = dcx == 0 ? CHUNK_WIDTH : x0 + 1;
+        const int z0 = dcz < 0 ? CHUNK_DEPTH - 1 : 0;
+        const int z1 = dcz == 0 ? CHUNK_DEPTH : z0 + 1;
+        it->second->copy_border_to_mesh_input(out, x0, x1, z0, z1, dcx * CHUNK_WIDTH, dcz * CHUNK_DEPTH);
+    };
+    
+    for (int dcz = -1; dcz <= 1; ++dcz) {
+        for (int dcx = -1; dcx <= 1; ++dcx) {
+            if (dcx != 0 || dcz != 0) copy_border(dcx, dcz);
+        }
+    }
+}
+
+bool World::section_hidden(const Chunk& chunk, int section) const {
+    if (chunk.section_empty(section)) return true;
+    if (!chunk.section_solid(section)) return false;
+    
+    // Above and below the world, and missing chunks, read as air
+    if (section == 0 || section == CHUNK_SECTIONS - 1) return false;
+    if (!chunk.section_solid(section - 1) || !chunk.section_solid(section + 1)) return false;
+    
+    static constexpr int kNeighbors[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+    for (const auto& offset : kNeighbors) {
+        auto it = chunks_.find({chunk.get_chunk_x() + offset[0], chunk.get_chunk_z() + offset[1]});
+        if (it == chunks_.end() || !it->second->section_solid(section)) return false;
+    }
+    return true;
+}
+
+std::shared_ptr<const ChunkMeshContext> World::capture_mesh_context() const {
+    auto ctx = std::make_shared<ChunkMeshContext>();
     
+    auto& registry = BlockRegistry::instance();
+    ctx->greedy_full_faces = core::Config::instance().get().render.voxel_greedy_meshing;
+    
+    const auto& models = BlockModelLoader::instance();
+    for (std::size_t i = 0; i < ChunkMeshContext::kBlockTypes; ++i) {
+        const auto type = static_cast<BlockType>(i);
+        const auto& info = registry.get_block_info(type);
+        for (int face = 0; face < 6; ++face) {
+            ctx->tile_ids[i][static_cast<std::size_t>(face)] =
+                static_cast<std::uint16_t>(info.texture_indices[static_cast<std::size_t>(face)]);
+        }
+        ctx->models[i] = models.get_model(type);
+    }
+    return ctx;
+}
+
+void World::schedule_mesh_jobs() {
     if (dirty_chunks_.empty()) {
         for (auto& [key, chunk] : chunks_) {
             (void)key;
-            if (chunk->needs_mesh_update()) {
+            if (chunk->has_unscheduled_mesh_update()) {
                 dirty_chunks_.push_back(chunk.get());
             }
         }
     }
     
-    if (!dirty_chunks_.empty()) {
-        // IMPORTANT: generating many chunk meshes in a single frame can stall for seconds.
-        // Keep mesh rebuild work budgeted per-frame so lighting/chunk streaming stays responsive.
-        constexpr float kMeshBudgetMs = 4.0f;
-        const auto t0 = std::chrono::steady_clock::now();
+    // Without worker threads submit() builds inline, so keep that budgeted
+    const bool inline_build = mesh_workers_->thread_count() == 0;
+    const auto t0 = std::chrono::steady_clock::now();
+    std::shared_ptr<const ChunkMeshContext> context;
+    
+    // One job per dirty section; a chunk leaves the queue once all of its
+    // dirty sections are submitted (or skipped)
+    bool stalled = false;
+    auto it = dirty_chunks_.begin();
+    while (it != dirty_chunks_.end() && !stalled) {
+        Chunk* chunk = *it;
         
-        auto it = dirty_chunks_.begin();
-        while (it != dirty_chunks_.end()) {
-            Chunk* chunk = *it;
+        for (int s = 0; s < CHUNK_SECTIONS; ++s) {
+            // A section dirtied again while its job runs is requeued when
+            // that job comes back stale.
+            if (!chunk->section_needs_mesh_update(s) || chunk->section_mesh_ticket(s) != 0) continue;
             
-            if (chunk->needs_mesh_update()) {
-                chunk->generate_mesh(*this);
-                
-                const auto t1 = std::chrono::steady_clock::now();
-                const float ms = std::chrono::duration<float, std::milli>(t1 - t0).count();
-                
-                it = dirty_chunks_.erase(it);
-                
-                if (ms >= kMeshBudgetMs) break;
+            if (section_hidden(*chunk, s)) {
+                chunk->skip_mesh(s);
+                continue;
+            }
+            if (!mesh_workers_->can_submit()) {
+                stalled = true;
+                break;
+            }
+            
+            if (!context) context = capture_mesh_context();
+            
+            ChunkMeshJob job = mesh_workers_->make_job();
+            job.ticket = next_mesh_ticket_++;
+            job.version = chunk->section_mesh_version(s);
+            job.context = context;
+            capture_mesh_input(*chunk, s, *job.input);
+            chunk->set_section_mesh_ticket(s, job.ticket);
+            mesh_workers_->submit(std::move(job));
+            
+            if (inline_build) {
+                const float ms = std::chrono::duration<float, std::milli>(
+                    std::chrono::steady_clock::now() - t0).count();
+                if (ms >= kMeshBudgetMs) {
+                    stalled = true;
+                    break;
+                }
+            }
+        }
+        
+        if (!stalled) it = dirty_chunks_.erase(it);
+    }
+}
+
+void World::upload_finished_meshes() {
+    const auto t0 = std::chrono::steady_clock::now();
+    
+    ChunkMeshJob job;
+    while (mesh_workers_->try_pop_completed(job)) {
+        // Unloaded (or unloaded and recreated) chunks no longer hold the ticket
+        Chunk* chunk = get_chunk(job.input->chunk_x, job.input->chunk_z);
+        const int section = job.input->section;
+        if (chunk && chunk->section_mesh_ticket(section) == job.ticket) {
+            chunk->set_section_mesh_ticket(section, 0);
+            if (chunk->section_mesh_version(section) == job.version) {
+                chunk->apply_mesh(section, *job.output);
             } else {
-                it = dirty_chunks_.erase(it);
+                // Edited after the snapshot: keep the old mesh and rebuild
+                chunk->mark_dirty(1u << section);
             }
         }
+        mesh_workers_->recycle(std::move(job));
+        
+        const float ms = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - t0).count();
+        if (ms >= kMeshBudgetMs) break;
     }
+}
+
+// =============================================================================
+// Skylight
+// =============================================================================
+
+SkylightChunk World::SkylightChunks::chunk(int cx, int cz) {
+    auto it = chunks_.find({cx, cz});
+    if (it == chunks_.end()) return {};
+    return {it->second->block_data(), &it->second->light(), it->second->height()};
+}
+
+void World::queue_chunk_light(int chunk_x, int chunk_z) {
+    const auto key = std::make_pair(chunk_x, chunk_z);
+    if (std::find(unlit_chunks_.begin(), unlit_chunks_.end(), key) == unlit_chunks_.end()) {
+        unlit_chunks_.push_back(key);
+    }
+}
+
+void World::light_queued_chunks() {
+    if (unlit_chunks_.empty()) return;
     
-    last_player_position_ = player_position;
+    // One batch, so chunks loaded together never relight each other's borders
+    skylight_.chunks_loaded(unlit_chunks_);
+    unlit_chunks_.clear();
+    apply_skylight_changes();
+}
+
+void World::relight_block(int x, int y, int z, Block old) {
+    // Chunks still waiting for their first batch are lit from scratch anyway
+    const auto key = std::make_pair(floor_div_int(x, CHUNK_WIDTH), floor_div_int(z, CHUNK_DEPTH));
+    if (std::find(unlit_chunks_.begin(), unlit_chunks_.end(), key) != unlit_chunks_.end()) return;
+    
+    skylight_.block_changed(x, y, z, old);
+    apply_skylight_changes();
+}
+
+void World::apply_skylight_changes() {
+    auto mark_chunk_dirty = [this](int cx, int cz, std::uint32_t sections) {
+        auto it = chunks_.find({cx, cz});
+        if (it != chunks_.end()) {
+            it->second->mark_dirty(sections);
+        }
+    };
+    
+    // Neighbours read changed border cells through their mesh apron
+    for (const SkylightChange& change : skylight_.take_changes()) {
+        const std::uint32_t sections = change.sections;
+        mark_chunk_dirty(change.cx, change.cz, sections);
+        if (change.borders & SkylightChange::NegX) mark_chunk_dirty(change.cx - 1, change.cz, sections);
+        if (change.borders & SkylightChange::PosX) mark_chunk_dirty(change.cx + 1, change.cz, sections);
+        if (change.borders & SkylightChange::NegZ) mark_chunk_dirty(change.cx, change.cz - 1, sections);
+        if (change.borders & SkylightChange::PosZ) mark_chunk_dirty(change.cx, change.cz + 1, sections);
+    }
 }
 
 void World::load_chunks_around_player(const rf::Vec3& player_position) {
@@ -621,7 +814,14 @@ void World::unload_distant_chunks(const rf::Vec3& player_position) {
             if (dirty_it != dirty_chunks_.end()) {
                 dirty_chunks_.erase(dirty_it);
             }
+            const auto [cx, cz] = it->first;
+            auto unlit_it = std::find(unlit_chunks_.begin(), unlit_chunks_.end(), it->first);
+            if (unlit_it != unlit_chunks_.end()) {
+                unlit_chunks_.erase(unlit_it);
+            }
             it = chunks_.erase(it);
+            skylight_.chunk_unloaded(cx, cz);
+            apply_skylight_changes();
         } else {
             ++it;
         }
@@ -632,13 +832,48 @@ void World::unload_distant_chunks(const rf::Vec3& player_position) {
 // Rendering
 // =============================================================================
 
+template <typename Visible>
+void World::draw_chunks(rf::GLShader& shader, Visible&& is_visible) const {
+    auto& registry = BlockRegistry::instance();
+    const float t = std::clamp(temperature(), 0.0f, 1.0f);
+    const float h = std::clamp(humidity(), 0.0f, 1.0f);
+    const rf::Color grass = registry.sample_grass_color(t, h);
+    const rf::Color foliage = registry.sample_foliage_color(t, h);
+    
+    shader.setInt("atlasTilesPerRow", std::max(1, registry.get_atlas_texture().width() / 16));
+    shader.setVec3("grassTint", rf::Vec3(grass.r, grass.g, grass.b) / 255.0f);
+    shader.setVec3("foliageTint", rf::Vec3(foliage.r, foliage.g, foliage.b) / 255.0f);
+    
+    const GLint origin_loc = shader.getUniformLocation("chunkOrigin");
+    for (const auto& [coord, chunk] : chunks_) {
+        if (!chunk || !chunk->is_generated()) continue;
+        
+        // Whole column first, then each section that has a mesh
+        const int height = chunk->height();
+        if (height == 0 || !is_visible(coord, 0, height)) continue;
+        
+        bool origin_set = false;
+        for (int s = 0; s < height / CHUNK_SECTION_HEIGHT; ++s) {
+            if (!chunk->has_section_mesh(s) ||
+                !is_visible(coord, s * CHUNK_SECTION_HEIGHT, (s + 1) * CHUNK_SECTION_HEIGHT)) {
+                continue;
+            }
+            if (!origin_set) {
+                shader.setVec3(origin_loc, chunk->get_world_position());
+                origin_set = true;
+            }
+            chunk->render_section(s);
+        }
+    }
+}
+
 void World::render(const rf::Camera& camera) const {
     if (!voxel_shader_.isValid()) return;
 
     auto& shader = const_cast<rf::GLShader&>(voxel_shader_);
     shader.bind();
 
-    // MVP = projection * view (model is identity for chunks — vertices are in world space)
+    // MVP = projection * view (model is identity; chunkOrigin places each chunk)
     rf::Mat4 view = camera.viewMatrix();
     rf::Mat4 proj = camera.projectionMatrix();
     rf::Mat4 model = rf::Mat4(1.0f);
@@ -701,11 +936,7 @@ void World::render(const rf::Camera& camera) const {
     shader.setFloat("fogEnd", get_fog_end());
 
     // Draw all chunks
-    for (const auto& [coord, chunk] : chunks_) {
-        if (chunk && chunk->is_generated()) {
-            chunk->render();
-        }
-    }
+    draw_chunks(shader, [](const auto&, int, int) { return true; });
 
     rf::GLShader::unbind();
 }
@@ -782,13 +1013,9 @@ void World::render(const rf::Camera& camera, rf::RenderPipeline& pipeline) const
     // Update frustum and draw visible chunks
     pipeline.updateFrustum(camera);
 
-    for (const auto& [coord, chunk] : chunks_) {
-        if (chunk && chunk->is_generated()) {
-            if (pipeline.isChunkVisible(coord.first, coord.second)) {
-                chunk->render();
-            }
-        }
-    }
+    draw_chunks(shader, [&pipeline](const auto& coord, int min_y, int max_y) {
+        return pipeline.isChunkVisible(coord.first, coord.second, min_y, max_y);
+    });
 
     rf::GLShader::unbind();
 }
@@ -804,13 +1031,8 @@ void World::renderShadowPass(rf::GLShader& shadowShader, rf::RenderPipeline& /*p
     }
     shadowShader.setInt("texture0", 0);
 
-    for (const auto& [coord, chunk] : chunks_) {
-        if (chunk && chunk->is_generated()) {
-            // Shadow frustum culling not strictly needed (ortho covers area)
-            // but skip very distant chunks for performance
-            chunk->render();
-        }
-    }
+    // Shadow frustum culling not strictly needed (ortho covers area)
+    draw_chunks(shadowShader, [](const auto&, int, int) { return true; });
 }
 
 // -----------------------------------------------------------------------------
@@ -2,6 +2,7 @@
 
 #include "engine/core/export.hpp"
 #include "chunk.hpp"
+#include "chunk_mesh_workers.hpp"
 #include "engine/core/math_types.hpp"
 #include "engine/renderer/gl_shader.hpp"
 #include "engine/renderer/camera.hpp"
@@ -58,6 +59,18 @@ public:
     
     void recompute_chunk_states(int chunkX, int chunkZ);
     
+    /// Snapshot one section of a chunk and its neighbour border for the mesher.
+    void capture_mesh_input(const Chunk& chunk, int section, ChunkMeshInput& out) const;
+    
+    /// Section has nothing to draw: all air, or solid cubes boxed in by
+    /// solid sections on every side.
+    bool section_hidden(const Chunk& chunk, int section) const;
+    
+    /// Atlas tiles and block models for the mesher.
+    std::shared_ptr<const ChunkMeshContext> capture_mesh_context() const;
+    
+    /// Streams chunks around the player, hands dirty chunks to the mesh
+    /// workers and uploads the meshes they have finished.
     void update(const rf::Vec3& player_position);
     /// Render all visible chunks using the voxel shader.
     void render(const rf::Camera& camera) const;
@@ -72,9 +85,10 @@ public:
     int get_render_distance() const { return render_distance_; }
     unsigned int get_seed() const { return seed_; }
 
-    bool has_map_template() const { return map_template_.has_value(); }
-    const shared::maps::MapTemplate* map_template() const { return map_template_ ? &*map_template_ : nullptr; }
-    void set_map_template(shared::maps::MapTemplate map);
+    bool has_map_template() const { return map_template_ != nullptr; }
+    const shared::maps::MapTemplate* map_template() const { return map_template_.get(); }
+    // Shared with any other holder of the same template (e.g. the local server).
+    void set_map_template(shared::maps::SharedMapTemplate map);
     void clear_map_template();
 
     float temperature() const;
@@ -117,6 +131,21 @@ private:
     void load_chunks_around_player(const rf::Vec3& player_position);
     void unload_distant_chunks(const rf::Vec3& player_position);
     void extract_lights_from_map();
+    void schedule_mesh_jobs();
+    void upload_finished_meshes();
+    
+    /// Skylight: queue a new (or replaced) chunk for the next batch, relight
+    /// around an edit, and dirty the meshes whose light changed.
+    void queue_chunk_light(int chunk_x, int chunk_z);
+    void light_queued_chunks();
+    void relight_block(int x, int y, int z, Block old);
+    void apply_skylight_changes();
+    
+    /// Atlas layout and biome tints the chunk shaders need to expand packed
+    /// vertices, then draw every meshed section that passes
+    /// is_visible(coord, min_y, max_y).
+    template <typename Visible>
+    void draw_chunks(rf::GLShader& shader, Visible&& is_visible) const;
     
     float perlin_noise(float x, float y) const;
     float octave_perlin(float x, float y, int octaves, float persistence) const;
@@ -132,7 +161,7 @@ private:
     float sun_intensity_{1.0f};
     float ambient_intensity_{0.5f};
 
-    std::optional<shared::maps::MapTemplate> map_template_{};
+    shared::maps::SharedMapTemplate map_template_{};
 
     std::optional<float> temperature_override_{};
 
@@ -162,6 +191,22 @@ private:
     int view_pos_loc_{-1};
     
     std::vector<Chunk*> dirty_chunks_;
+    
+    // The propagator's view of chunks_: every chunk in the map is loaded
+    class SkylightChunks final : public SkylightAccess {
+    public:
+        explicit SkylightChunks(ChunkMap& chunks) : chunks_(chunks) {}
+        SkylightChunk chunk(int cx, int cz) override;
+    private:
+        ChunkMap& chunks_;
+    };
+    SkylightChunks skylight_chunks_{chunks_};
+    SkylightPropagator skylight_{skylight_chunks_};
+    std::vector<std::pair<int, int>> unlit_chunks_;  // Lit together at the start of update()
+    
+    // Background meshing: tickets tie results back to the chunk that asked
+    std::unique_ptr<ChunkMeshWorkers> mesh_workers_;
+    std::uint64_t next_mesh_ticket_{1};
 };
 
 } // namespace voxel
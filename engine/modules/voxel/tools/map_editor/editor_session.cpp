@@ -53,7 +53,7 @@ void EditorSession::send_input(float moveX, float moveY, float yaw, float pitch,
     input.sprint = sprint;
     input.camUp = camUp;
     input.camDown = camDown;
-    send_message(input);
+    send_message(input, engine::Delivery::UnreliableSequenced);
 }
 
 void EditorSession::send_try_set_block(int x, int y, int z, shared::voxel::BlockType blockType,
@@ -100,10 +100,10 @@ void EditorSession::send_try_export_map(const std::string& mapId,
     send_message(msg);
 }
 
-void EditorSession::send_message(const proto::Message& msg) {
+void EditorSession::send_message(const proto::Message& msg, engine::Delivery delivery) {
     auto data = proto::serialize(msg);
     TraceLog(LOG_DEBUG, "[editor] Sending message (%zu bytes)", data.size());
-    transport_->send(data);
+    transport_->send(data, engine::transport::SendOptions::for_delivery(delivery));
 }
 
 void EditorSession::handle_message(const proto::Message& msg) {
@@ -127,6 +127,21 @@ void EditorSession::handle_message(const proto::Message& msg) {
         else if constexpr (std::is_same_v<T, proto::BlockBroken>) {
             if (onBlockBroken_) onBlockBroken_(m);
         }
+        else if constexpr (std::is_same_v<T, proto::WorldDelta>) {
+            // Late-join sync arrives batched; replay it through the per-block callbacks.
+            for (const auto& chunk : m.chunks) {
+                for (const auto& b : chunk.blocks) {
+                    const int x = chunk.chunkX * 16 + (b.localIndex & 15);
+                    const int y = b.localIndex >> 8;
+                    const int z = chunk.chunkZ * 16 + ((b.localIndex >> 4) & 15);
+                    if (b.blockType == proto::BlockType::Air) {
+                        if (onBlockBroken_) onBlockBroken_(proto::BlockBroken{x, y, z});
+                    } else if (onBlockPlaced_) {
+                        onBlockPlaced_(proto::BlockPlaced{x, y, z, b.blockType, b.stateByte});
+                    }
+                }
+            }
+        }
         else if constexpr (std::is_same_v<T, proto::ActionRejected>) {
             TraceLog(LOG_WARNING, "[editor] ActionRejected: seq=%u reason=%u", m.seq, static_cast<unsigned>(m.reason));
             if (onActionRejected_) onActionRejected_(m);
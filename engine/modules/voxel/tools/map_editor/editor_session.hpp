@@ -63,7 +63,7 @@ public:
 
 private:
     void handle_message(const proto::Message& msg);
-    void send_message(const proto::Message& msg);
+    void send_message(const proto::Message& msg, engine::Delivery delivery = engine::Delivery::ReliableOrdered);
 
     std::shared_ptr<engine::transport::IClientTransport> transport_;
 
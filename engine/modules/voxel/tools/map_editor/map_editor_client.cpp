@@ -335,7 +335,7 @@ void MapEditorClient::send_input_frame() {
     msg.camUp = camUp;
     msg.camDown = camDown;
 
-    send_message(msg);
+    send_message(msg, engine::Delivery::UnreliableSequenced);
 }
 
 void MapEditorClient::update_interpolation(float dt) {
@@ -734,6 +734,9 @@ void MapEditorClient::handle_message(const proto::Message& msg) {
         else if constexpr (std::is_same_v<T, proto::BlockBroken>) {
             handle_block_broken(m);
         }
+        else if constexpr (std::is_same_v<T, proto::WorldDelta>) {
+            handle_world_delta(m);
+        }
         else if constexpr (std::is_same_v<T, proto::ActionRejected>) {
             handle_action_rejected(m);
         }
@@ -756,11 +759,11 @@ void MapEditorClient::handle_server_hello(const proto::ServerHello& msg) {
     if (auto* world = engine_->world()) {
         if (pendingLoadedMap_.has_value()) {
             visualSettings_ = pendingLoadedMap_->visualSettings;
-            world->set_map_template(*pendingLoadedMap_);
+            world->set_map_template(std::make_shared<const shared::maps::MapTemplate>(*pendingLoadedMap_));
         } else {
             shared::maps::MapTemplate empty = make_empty_template(createParams_);
             visualSettings_ = empty.visualSettings;
-            world->set_map_template(std::move(empty));
+            world->set_map_template(std::make_shared<const shared::maps::MapTemplate>(std::move(empty)));
         }
 
         skyboxParams_.needsRefresh = true;
@@ -797,6 +800,22 @@ void MapEditorClient::handle_block_broken(const proto::BlockBroken& msg) {
     }
 }
 
+void MapEditorClient::handle_world_delta(const proto::WorldDelta& msg) {
+    auto* world = engine_->world();
+    if (!world) return;
+
+    for (const auto& chunk : msg.chunks) {
+        const int baseX = chunk.chunkX * shared::voxel::CHUNK_WIDTH;
+        const int baseZ = chunk.chunkZ * shared::voxel::CHUNK_DEPTH;
+        for (const auto& b : chunk.blocks) {
+            auto state = shared::voxel::BlockRuntimeState::from_byte(b.stateByte);
+            world->set_block_with_state(baseX + (b.localIndex & 15), b.localIndex >> 8,
+                                        baseZ + ((b.localIndex >> 4) & 15),
+                                        static_cast<voxel::Block>(b.blockType), state);
+        }
+    }
+}
+
 void MapEditorClient::handle_action_rejected(const proto::ActionRejected& msg) {
     engine_->log(engine::LogLevel::Warning, "Action rejected: seq=" + std::to_string(msg.seq));
     lastReject_ = msg;
@@ -856,9 +875,9 @@ void MapEditorClient::send_try_export_map() {
 }
 
 template<typename T>
-void MapEditorClient::send_message(const T& msg) {
+void MapEditorClient::send_message(const T& msg, engine::Delivery delivery) {
     auto data = proto::serialize(proto::Message{msg});
-    engine_->send(data);
+    engine_->send(data, delivery);
 }
 
 // =============================================================================
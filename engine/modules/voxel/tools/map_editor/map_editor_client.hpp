@@ -147,6 +147,7 @@ private:
     void handle_state_snapshot(const bedwars::proto::StateSnapshot& msg);
     void handle_block_placed(const bedwars::proto::BlockPlaced& msg);
     void handle_block_broken(const bedwars::proto::BlockBroken& msg);
+    void handle_world_delta(const bedwars::proto::WorldDelta& msg);
     void handle_action_rejected(const bedwars::proto::ActionRejected& msg);
     void handle_export_result(const bedwars::proto::ExportResult& msg);
 
@@ -159,7 +160,7 @@ private:
     void send_try_export_map();
 
     template<typename T>
-    void send_message(const T& msg);
+    void send_message(const T& msg, engine::Delivery delivery = engine::Delivery::ReliableOrdered);
 
     // --- Update helpers ---
     void update_ecs(float dt);
@@ -17,12 +17,14 @@ GLMesh::~GLMesh() {
 GLMesh::GLMesh(GLMesh&& other) noexcept
     : vao_(other.vao_)
     , vertexCount_(other.vertexCount_)
+    , indexCount_(other.indexCount_)
     , dynamic_(other.dynamic_)
 {
     std::memcpy(vbos_, other.vbos_, sizeof(vbos_));
     other.vao_ = 0;
     std::memset(other.vbos_, 0, sizeof(other.vbos_));
     other.vertexCount_ = 0;
+    other.indexCount_ = 0;
 }
 
 GLMesh& GLMesh::operator=(GLMesh&& other) noexcept {
@@ -31,10 +33,12 @@ GLMesh& GLMesh::operator=(GLMesh&& other) noexcept {
         vao_ = other.vao_;
         std::memcpy(vbos_, other.vbos_, sizeof(vbos_));
         vertexCount_ = other.vertexCount_;
+        indexCount_ = other.indexCount_;
         dynamic_ = other.dynamic_;
         other.vao_ = 0;
         std::memset(other.vbos_, 0, sizeof(other.vbos_));
         other.vertexCount_ = 0;
+        other.indexCount_ = 0;
     }
     return *this;
 }
@@ -166,6 +170,49 @@ void GLMesh::update(int vertexCount,
     glBindBuffer(GL_ARRAY_BUFFER, 0);
 }
 
+// ============================================================================
+// Interleaved upload (packed voxel chunks)
+// ============================================================================
+
+void GLMesh::uploadInterleaved(const void* data, int vertexCount, GLsizei stride,
+                               const VertexAttrib* attribs, int attribCount,
+                               GLuint elementBuffer, int indexCount)
+{
+    destroy();
+    if (!data || vertexCount <= 0 || stride <= 0) return;
+
+    vertexCount_ = vertexCount;
+    indexCount_ = elementBuffer ? indexCount : 0;
+    dynamic_ = false;
+
+    glGenVertexArrays(1, &vao_);
+    glBindVertexArray(vao_);
+
+    // All attributes share the first VBO slot
+    glGenBuffers(1, &vbos_[0]);
+    glBindBuffer(GL_ARRAY_BUFFER, vbos_[0]);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertexCount) * stride, data, GL_STATIC_DRAW);
+
+    for (int i = 0; i < attribCount; ++i) {
+        const VertexAttrib& a = attribs[i];
+        const void* offset = reinterpret_cast<const void*>(a.offset);
+        glEnableVertexAttribArray(a.index);
+        if (a.integer) {
+            glVertexAttribIPointer(a.index, a.size, a.type, stride, offset);
+        } else {
+            glVertexAttribPointer(a.index, a.size, a.type, a.normalized ? GL_TRUE : GL_FALSE, stride, offset);
+        }
+    }
+
+    // Element buffer binding is VAO state, so it stays bound with vao_
+    if (elementBuffer) {
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elementBuffer);
+    }
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
 // ============================================================================
 // Position-only upload (skybox, fullscreen quad)
 // ============================================================================
@@ -206,6 +253,7 @@ void GLMesh::destroy() {
         vao_ = 0;
     }
     vertexCount_ = 0;
+    indexCount_ = 0;
 }
 
 // ============================================================================
@@ -215,8 +263,52 @@ void GLMesh::destroy() {
 void GLMesh::draw(GLenum mode) const {
     if (!vao_ || vertexCount_ <= 0) return;
     glBindVertexArray(vao_);
-    glDrawArrays(mode, 0, vertexCount_);
+    if (indexCount_ > 0) {
+        glDrawElements(mode, indexCount_, GL_UNSIGNED_INT, nullptr);
+    } else {
+        glDrawArrays(mode, 0, vertexCount_);
+    }
+    glBindVertexArray(0);
+}
+
+// ============================================================================
+// Shared quad index buffer
+// ============================================================================
+
+GLuint GLMesh::sharedQuadIndexBuffer(int quadCount) {
+    static GLuint buffer = 0;
+    static int capacity = 0;
+
+    if (buffer == 0) {
+        glGenBuffers(1, &buffer);
+    }
+    if (quadCount <= capacity) return buffer;
+
+    // Grow geometrically so a map load does not rebuild it per chunk
+    int newCapacity = capacity > 0 ? capacity : 4096;
+    while (newCapacity < quadCount) newCapacity *= 2;
+
+    std::vector<std::uint32_t> indices(static_cast<std::size_t>(newCapacity) * 6);
+    for (int q = 0; q < newCapacity; ++q) {
+        const auto base = static_cast<std::uint32_t>(q * 4);
+        std::uint32_t* out = &indices[static_cast<std::size_t>(q) * 6];
+        out[0] = base;
+        out[1] = base + 1;
+        out[2] = base + 2;
+        out[3] = base;
+        out[4] = base + 2;
+        out[5] = base + 3;
+    }
+
+    // Bind outside any VAO so the binding does not leak into one
     glBindVertexArray(0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(indices.size() * sizeof(std::uint32_t)),
+                 indices.data(), GL_STATIC_DRAW);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+
+    capacity = newCapacity;
+    return buffer;
 }
 
 // ============================================================================
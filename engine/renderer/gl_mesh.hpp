@@ -30,6 +30,16 @@ public:
         ATTRIB_COLOR      = 4,  // vec4 vertexColor (RGBA ubyte, normalized)
     };
 
+    /// One attribute of an interleaved vertex buffer (see uploadInterleaved).
+    struct VertexAttrib {
+        GLuint index;          // Shader attribute location
+        GLint size;            // Components (1-4)
+        GLenum type;           // GL_FLOAT, GL_UNSIGNED_SHORT, ...
+        bool normalized;       // Float attributes only
+        bool integer;          // Bind with glVertexAttribIPointer (int/uint shader input)
+        std::size_t offset;    // Byte offset inside one vertex
+    };
+
     GLMesh() = default;
     ~GLMesh();
 
@@ -67,6 +77,16 @@ public:
                 const float* normals = nullptr,
                 const std::uint8_t* colors = nullptr);
 
+    /// Upload one interleaved vertex buffer with a caller-defined layout.
+    /// @param data          vertexCount * stride bytes.
+    /// @param attribs       Attribute layout inside one vertex.
+    /// @param elementBuffer Optional index buffer (GL_UNSIGNED_INT) to draw with; not owned
+    ///                      (e.g. sharedQuadIndexBuffer()). 0 draws the vertices in order.
+    /// @param indexCount    Indices to draw when elementBuffer is set.
+    void uploadInterleaved(const void* data, int vertexCount, GLsizei stride,
+                           const VertexAttrib* attribs, int attribCount,
+                           GLuint elementBuffer = 0, int indexCount = 0);
+
     /// Upload a simple position-only mesh (e.g. skybox cube, fullscreen quad).
     void uploadPositionOnly(const float* positions, int vertexCount);
 
@@ -83,6 +103,7 @@ public:
 
     bool isValid() const { return vao_ != 0; }
     int vertexCount() const { return vertexCount_; }
+    int indexCount() const { return indexCount_; }
     GLuint vao() const { return vao_; }
 
     // ----- Utility mesh generators -----
@@ -102,6 +123,14 @@ public:
     /// Create a fullscreen triangle (covers [-1,1] NDC).
     static GLMesh createFullscreenTriangle();
 
+    // ----- Shared buffers -----
+
+    /// Element buffer drawing quads (4 vertices each) as two triangles,
+    /// (0,1,2) (0,2,3), for at least quadCount quads. Grows in place, so the
+    /// buffer name stays valid in VAOs that already reference it. Owned by
+    /// GLMesh for the lifetime of the GL context.
+    static GLuint sharedQuadIndexBuffer(int quadCount);
+
 private:
     GLuint vao_{0};
 
@@ -110,6 +139,7 @@ private:
     GLuint vbos_[kMaxVBOs]{};
 
     int vertexCount_{0};
+    int indexCount_{0};      // > 0 = draw with the element buffer bound in vao_
     bool dynamic_{false};
 };
 
@@ -223,10 +223,10 @@ void RenderPipeline::updateFrustum(const Camera& camera) {
     frustum_.extractFromVP(vp);
 }
 
-bool RenderPipeline::isChunkVisible(int chunkX, int chunkZ, int chunkHeight) const {
+bool RenderPipeline::isChunkVisible(int chunkX, int chunkZ, int minY, int maxY) const {
     // Chunk AABB in world space
-    Vec3 minPt(static_cast<float>(chunkX * 16), 0.0f, static_cast<float>(chunkZ * 16));
-    Vec3 maxPt(static_cast<float>(chunkX * 16 + 16), static_cast<float>(chunkHeight),
+    Vec3 minPt(static_cast<float>(chunkX * 16), static_cast<float>(minY), static_cast<float>(chunkZ * 16));
+    Vec3 maxPt(static_cast<float>(chunkX * 16 + 16), static_cast<float>(maxY),
                static_cast<float>(chunkZ * 16 + 16));
     return frustum_.testAABB(minPt, maxPt);
 }
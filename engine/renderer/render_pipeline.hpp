@@ -92,8 +92,8 @@ public:
     /// Extract frustum from current camera VP.
     void updateFrustum(const Camera& camera);
 
-    /// Test chunk AABB against the current frustum.
-    bool isChunkVisible(int chunkX, int chunkZ, int chunkHeight = 256) const;
+    /// Test the AABB of a chunk's [minY, maxY) slab against the current frustum.
+    bool isChunkVisible(int chunkX, int chunkZ, int minY = 0, int maxY = 256) const;
 
     // ----- Accessors -----
 
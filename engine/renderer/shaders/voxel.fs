@@ -22,6 +22,8 @@ in float fragAO;
 in float fragFoliageMask;
 in vec4 fragPosLightSpace;
 in float fragDist;
+flat in vec3 fragTile;
+flat in float fragRepeat;
 
 out vec4 finalColor;
 
@@ -104,8 +106,18 @@ float calcShadow(vec4 posLightSpace) {
 // =============================================================================
 
 void main() {
-    // Sample texture from atlas
-    vec4 texelColor = texture(texture0, fragTexCoord);
+    // Sample texture from atlas. Texcoords are in tile units; greedy-merged
+    // quads span several tiles and wrap back into the block's tile, taking
+    // gradients from the unwrapped coordinate so mip selection doesn't jump
+    // at block edges.
+    vec2 tileUV = fragTexCoord * fragTile.z;
+    vec4 texelColor;
+    if (fragRepeat > 0.5) {
+        vec2 uv = fragTile.xy + fract(fragTexCoord) * fragTile.z;
+        texelColor = textureGrad(texture0, uv, dFdx(tileUV), dFdy(tileUV));
+    } else {
+        texelColor = texture(texture0, fragTile.xy + tileUV);
+    }
 
     // Discard fully transparent pixels (for leaves, etc.)
     if (texelColor.a < 0.1) {
@@ -117,7 +129,7 @@ void main() {
     // The HDR pipeline expects linear-space inputs, so we degamma here.
     texelColor.rgb = pow(texelColor.rgb, vec3(2.2));
 
-    // Apply vertex color tint (foliage/grass recolor or white)
+    // Apply biome tint (foliage/grass recolor or white)
     vec3 tintedColor = texelColor.rgb * fragTint;
 
     vec3 normal = normalize(fragNormal);
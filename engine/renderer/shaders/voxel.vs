@@ -1,11 +1,10 @@
 #version 330
 
-// Vertex attributes (explicit locations matching GLMesh::Attrib)
-layout(location = 0) in vec3 vertexPosition;
-layout(location = 1) in vec2 vertexTexCoord;
-layout(location = 2) in vec2 vertexTexCoord2;  // .x = foliageMask, .y = ao (0..1)
-layout(location = 3) in vec3 vertexNormal;
-layout(location = 4) in vec4 vertexColor;      // RGBA: rgb = tint, a = skylight
+// Vertex attributes (packed chunk vertex, see voxel/client/chunk_vertex.hpp)
+layout(location = 0) in vec3 vertexPosition;   // Chunk-local, 1/128 block units
+layout(location = 1) in uvec2 vertexFaceShade; // .x = normal index | repeat << 4, .y = skylight | ao << 4 | tint << 6
+layout(location = 2) in vec2 vertexTexCoord;   // Inside the atlas tile, 1/16 tile units
+layout(location = 3) in uint vertexTile;       // Atlas tile index (row-major)
 
 out vec2 fragTexCoord;
 out vec3 fragTint;
@@ -16,6 +15,8 @@ out float fragAO;
 out float fragFoliageMask;
 out vec4 fragPosLightSpace;
 out float fragDist;             // distance from camera for fog
+flat out vec3 fragTile;         // xy = atlas tile origin, z = tile uv size
+flat out float fragRepeat;      // 1 = wrap fragTexCoord into the tile (greedy quads)
 
 uniform mat4 mvp;
 uniform mat4 matModel;
@@ -23,15 +24,40 @@ uniform mat4 matNormal;
 uniform mat4 lightSpaceMatrix;  // Shadow map VP
 uniform vec3 viewPos;
 
+uniform vec3 chunkOrigin;       // World position of the chunk's (0,0,0) corner
+uniform int atlasTilesPerRow;
+uniform vec3 grassTint;
+uniform vec3 foliageTint;
+
+const vec3 kNormals[10] = vec3[10](
+    vec3( 1.0, 0.0, 0.0), vec3(-1.0, 0.0, 0.0),
+    vec3( 0.0, 1.0, 0.0), vec3( 0.0,-1.0, 0.0),
+    vec3( 0.0, 0.0, 1.0), vec3( 0.0, 0.0,-1.0),
+    vec3(-0.707, 0.0, 0.707), vec3( 0.707, 0.0,-0.707),
+    vec3( 0.707, 0.0, 0.707), vec3(-0.707, 0.0,-0.707)
+);
+const float kAO[4] = float[4](0.2, 0.5, 0.75, 1.0);
+
 void main() {
-    fragTexCoord = vertexTexCoord;
-    fragTint = vertexColor.rgb;
-    fragSkyLight = vertexColor.a; // Normalized 0..1 from 0..255
+    uint face = vertexFaceShade.x;
+    uint shade = vertexFaceShade.y;
+    uint tint = (shade >> 6u) & 3u;
+
+    vec3 position = chunkOrigin + vertexPosition * (1.0 / 128.0);
+
+    float tileSize = 1.0 / float(atlasTilesPerRow);
+    uint perRow = uint(atlasTilesPerRow);
+    fragTile = vec3(vec2(float(vertexTile % perRow), float(vertexTile / perRow)) * tileSize, tileSize);
+    fragRepeat = float((face >> 4u) & 1u);
+    fragTexCoord = vertexTexCoord * (1.0 / 16.0);
+
+    fragTint = tint == 1u ? grassTint : (tint == 2u ? foliageTint : vec3(1.0));
+    fragFoliageMask = tint != 0u ? 1.0 : 0.0;
+    fragSkyLight = float(shade & 15u) / 15.0;
+    fragAO = kAO[(shade >> 4u) & 3u];
 
-    fragNormal = normalize(vec3(matNormal * vec4(vertexNormal, 0.0)));
-    fragPos = vec3(matModel * vec4(vertexPosition, 1.0));
-    fragAO = vertexTexCoord2.y;
-    fragFoliageMask = vertexTexCoord2.x;
+    fragNormal = normalize(vec3(matNormal * vec4(kNormals[min(face & 15u, 9u)], 0.0)));
+    fragPos = vec3(matModel * vec4(position, 1.0));
 
     // Shadow map space position
     fragPosLightSpace = lightSpaceMatrix * vec4(fragPos, 1.0);
@@ -39,5 +65,5 @@ void main() {
     // Distance from camera (for fog)
     fragDist = length(fragPos - viewPos);
 
-    gl_Position = mvp * vec4(vertexPosition, 1.0);
+    gl_Position = mvp * vec4(position, 1.0);
 }
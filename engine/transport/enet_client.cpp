@@ -81,17 +81,17 @@ bool ENetClientTransport::connect(const std::string& host, std::uint16_t port,
     return false;
 }
 
-void ENetClientTransport::send(std::span<const std::uint8_t> data) {
+void ENetClientTransport::send(std::span<const std::uint8_t> data, SendOptions options) {
     if (!connected_ || !peer_) return;
 
     ENetPacket* packet = enet_packet_create(
         data.data(),
         data.size(),
-        ENET_PACKET_FLAG_RELIABLE
+        packet_flags(options.delivery)
     );
 
     if (packet) {
-        enet_peer_send(peer_, static_cast<std::uint8_t>(Channel::Reliable), packet);
+        enet_peer_send(peer_, channel_id(options.channel), packet);
     }
 }
 
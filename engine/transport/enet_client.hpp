@@ -36,7 +36,7 @@ public:
 
     // --- IClientTransport implementation ---
     
-    void send(std::span<const std::uint8_t> data) override;
+    void send(std::span<const std::uint8_t> data, SendOptions options = {}) override;
     void poll(std::uint32_t timeoutMs = 0) override;
     bool is_connected() const override;
     void disconnect() override;
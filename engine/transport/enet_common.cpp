@@ -5,6 +5,15 @@
 
 namespace engine::transport {
 
+namespace {
+
+void release_pooled_packet(ENetPacket* packet) {
+    // Adopt the reference taken in create_pooled_packet and drop it
+    PacketRef::attach(static_cast<PacketBuffer*>(packet->userData));
+}
+
+} // namespace
+
 ENetInitializer::ENetInitializer() {
     if (enet_initialize() == 0) {
         initialized_ = true;
@@ -19,4 +28,27 @@ ENetInitializer::~ENetInitializer() {
     }
 }
 
+std::uint32_t packet_flags(Delivery delivery) {
+    switch (delivery) {
+        case Delivery::ReliableOrdered:     return ENET_PACKET_FLAG_RELIABLE;
+        case Delivery::UnreliableSequenced: return 0;
+        case Delivery::UnreliableFragment:  return ENET_PACKET_FLAG_UNRELIABLE_FRAGMENT;
+    }
+    return ENET_PACKET_FLAG_RELIABLE;
+}
+
+ENetPacket* create_pooled_packet(const PacketRef& packet, Delivery delivery) {
+    const auto data = packet.data();
+    ENetPacket* enetPacket = enet_packet_create(
+        data.data(),
+        data.size(),
+        packet_flags(delivery) | ENET_PACKET_FLAG_NO_ALLOCATE
+    );
+    if (!enetPacket) return nullptr;
+
+    enetPacket->userData = PacketRef(packet).detach();
+    enetPacket->freeCallback = release_pooled_packet;
+    return enetPacket;
+}
+
 } // namespace engine::transport
@@ -3,6 +3,7 @@
 // ENet common utilities for engine transport layer.
 // Forward declarations avoid Windows header conflicts.
 
+#include "transport.hpp"
 #include "engine/core/export.hpp"
 
 #include <cstddef>
@@ -49,12 +50,20 @@ namespace config {
 }
 
 // ============================================================================
-// Channels
+// Delivery mapping
 // ============================================================================
 
-enum class Channel : std::uint8_t {
-    Reliable = 0,
-    Unreliable = 1,
-};
+/// ENet packet flags for a delivery mode.
+RAYFLOW_CORE_API std::uint32_t packet_flags(Delivery delivery);
+
+/// ENet packet that references a pooled buffer instead of copying it
+/// (ENET_PACKET_FLAG_NO_ALLOCATE). Holds a reference until ENet frees the packet.
+RAYFLOW_CORE_API ENetPacket* create_pooled_packet(const PacketRef& packet, Delivery delivery);
+
+/// ENet channel id for a send, clamped to the channels the host was created with.
+inline std::uint8_t channel_id(Channel channel) {
+    const auto id = static_cast<std::uint8_t>(channel);
+    return id < config::kChannelCount ? id : static_cast<std::uint8_t>(Channel::Reliable);
+}
 
 } // namespace engine::transport
@@ -70,35 +70,58 @@ void ENetServerTransport::stop() {
     std::fprintf(stderr, "[enet_server] stopped\n");
 }
 
-void ENetServerTransport::send(ClientId id, std::span<const std::uint8_t> data) {
+void ENetServerTransport::send(ClientId id, std::span<const std::uint8_t> data, SendOptions options) {
     auto it = clients_.find(id);
     if (it == clients_.end()) return;
 
     ENetPacket* packet = enet_packet_create(
         data.data(),
         data.size(),
-        ENET_PACKET_FLAG_RELIABLE
+        packet_flags(options.delivery)
     );
 
     if (packet) {
-        enet_peer_send(it->second, static_cast<std::uint8_t>(Channel::Reliable), packet);
+        enet_peer_send(it->second, channel_id(options.channel), packet);
     }
 }
 
-void ENetServerTransport::broadcast(std::span<const std::uint8_t> data) {
+void ENetServerTransport::broadcast(std::span<const std::uint8_t> data, SendOptions options) {
     if (!host_) return;
 
     ENetPacket* packet = enet_packet_create(
         data.data(),
         data.size(),
-        ENET_PACKET_FLAG_RELIABLE
+        packet_flags(options.delivery)
     );
 
     if (packet) {
-        enet_host_broadcast(host_, static_cast<std::uint8_t>(Channel::Reliable), packet);
+        enet_host_broadcast(host_, channel_id(options.channel), packet);
     }
 }
 
+void ENetServerTransport::send_packet(ClientId id, const PacketRef& packet, SendOptions options) {
+    auto it = clients_.find(id);
+    if (it == clients_.end()) return;
+
+    ENetPacket* enetPacket = create_pooled_packet(packet, options.delivery);
+    if (!enetPacket) return;
+
+    // On failure ENet did not take the packet: destroy it to release the buffer
+    if (enet_peer_send(it->second, channel_id(options.channel), enetPacket) < 0 &&
+        enetPacket->referenceCount == 0) {
+        enet_packet_destroy(enetPacket);
+    }
+}
+
+void ENetServerTransport::broadcast_packet(const PacketRef& packet, SendOptions options) {
+    if (!host_) return;
+
+    ENetPacket* enetPacket = create_pooled_packet(packet, options.delivery);
+    if (!enetPacket) return;
+
+    enet_host_broadcast(host_, channel_id(options.channel), enetPacket);
+}
+
 void ENetServerTransport::poll(std::uint32_t timeoutMs) {
     if (!host_) return;
 
@@ -40,8 +40,10 @@ public:
 
     // --- IServerTransport implementation ---
     
-    void send(ClientId id, std::span<const std::uint8_t> data) override;
-    void broadcast(std::span<const std::uint8_t> data) override;
+    void send(ClientId id, std::span<const std::uint8_t> data, SendOptions options = {}) override;
+    void broadcast(std::span<const std::uint8_t> data, SendOptions options = {}) override;
+    void send_packet(ClientId id, const PacketRef& packet, SendOptions options = {}) override;
+    void broadcast_packet(const PacketRef& packet, SendOptions options = {}) override;
     void poll(std::uint32_t timeoutMs = 0) override;
     void disconnect(ClientId id) override;
 
@@ -20,7 +20,7 @@ LocalTransportPair create_local_transport_pair() {
 // LocalClientTransport
 // ============================================================================
 
-void LocalClientTransport::send(std::span<const std::uint8_t> data) {
+void LocalClientTransport::send(std::span<const std::uint8_t> data, SendOptions /*options*/) {
     // Allow sending if connected OR if connection is pending (will be connected on next poll)
     if (!connected_ && !connect_pending_) return;
     
@@ -78,7 +78,7 @@ void LocalClientTransport::receive(std::vector<std::uint8_t> data) {
 // LocalServerTransport
 // ============================================================================
 
-void LocalServerTransport::send(ClientId id, std::span<const std::uint8_t> data) {
+void LocalServerTransport::send(ClientId id, std::span<const std::uint8_t> data, SendOptions /*options*/) {
     if (id != kLocalClientId || !client_connected_) return;
     
     if (auto cli = client_.lock()) {
@@ -86,7 +86,7 @@ void LocalServerTransport::send(ClientId id, std::span<const std::uint8_t> data)
     }
 }
 
-void LocalServerTransport::broadcast(std::span<const std::uint8_t> data) {
+void LocalServerTransport::broadcast(std::span<const std::uint8_t> data, SendOptions /*options*/) {
     send(kLocalClientId, data);
 }
 
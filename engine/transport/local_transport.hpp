@@ -36,7 +36,8 @@ class RAYFLOW_CORE_API LocalClientTransport : public IClientTransport {
     friend class LocalServerTransport;
 
 public:
-    void send(std::span<const std::uint8_t> data) override;
+    // In-process delivery never drops: options are ignored
+    void send(std::span<const std::uint8_t> data, SendOptions options = {}) override;
     void poll(std::uint32_t timeoutMs = 0) override;
     bool is_connected() const override { return connected_; }
     void disconnect() override;
@@ -64,8 +65,8 @@ class RAYFLOW_CORE_API LocalServerTransport : public IServerTransport {
     friend class LocalClientTransport;
 
 public:
-    void send(ClientId id, std::span<const std::uint8_t> data) override;
-    void broadcast(std::span<const std::uint8_t> data) override;
+    void send(ClientId id, std::span<const std::uint8_t> data, SendOptions options = {}) override;
+    void broadcast(std::span<const std::uint8_t> data, SendOptions options = {}) override;
     void poll(std::uint32_t timeoutMs = 0) override;
     void disconnect(ClientId id) override;
 
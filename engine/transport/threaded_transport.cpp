@@ -0,0 +1,154 @@
+#include "threaded_transport.hpp"
+
+#include <cstdio>
+
+namespace engine::transport {
+
+ThreadedServerTransport::ThreadedServerTransport(std::shared_ptr<IServerTransport> inner)
+    : ThreadedServerTransport(std::move(inner), Config{})
+{
+}
+
+ThreadedServerTransport::ThreadedServerTransport(std::shared_ptr<IServerTransport> inner, const Config& config)
+    : config_(config)
+    , inner_(std::move(inner))
+    , inbound_(config.queueCapacity)
+    , outbound_(config.queueCapacity)
+{
+    // Inner callbacks fire on the I/O thread (from inner_->poll/disconnect).
+    inner_->onClientConnect = [this](ClientId id) {
+        queue_inbound({Inbound::Kind::Connect, id, {}});
+    };
+    inner_->onClientDisconnect = [this](ClientId id) {
+        queue_inbound({Inbound::Kind::Disconnect, id, {}});
+    };
+    inner_->onReceive = [this](ClientId id, std::span<const std::uint8_t> data) {
+        queue_inbound({Inbound::Kind::Receive, id, PacketPool::instance().copy_of(data)});
+    };
+}
+
+ThreadedServerTransport::~ThreadedServerTransport() {
+    stop();
+    inner_->onClientConnect = nullptr;
+    inner_->onClientDisconnect = nullptr;
+    inner_->onReceive = nullptr;
+}
+
+void ThreadedServerTransport::start() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) return;
+    ioThread_ = std::thread([this] { io_loop(); });
+    std::fprintf(stderr, "[threaded_transport] I/O thread started\n");
+}
+
+void ThreadedServerTransport::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) return;
+    if (ioThread_.joinable()) {
+        ioThread_.join();
+    }
+    std::fprintf(stderr, "[threaded_transport] I/O thread stopped\n");
+}
+
+// ============================================================================
+// Game thread side
+// ============================================================================
+
+void ThreadedServerTransport::send(ClientId id, std::span<const std::uint8_t> data, SendOptions options) {
+    queue_outbound({Outbound::Kind::Send, id, PacketPool::instance().copy_of(data), options});
+}
+
+void ThreadedServerTransport::broadcast(std::span<const std::uint8_t> data, SendOptions options) {
+    queue_outbound({Outbound::Kind::Broadcast, kInvalidClientId, PacketPool::instance().copy_of(data), options});
+}
+
+void ThreadedServerTransport::send_packet(ClientId id, const PacketRef& packet, SendOptions options) {
+    queue_outbound({Outbound::Kind::Send, id, packet, options});
+}
+
+void ThreadedServerTransport::broadcast_packet(const PacketRef& packet, SendOptions options) {
+    queue_outbound({Outbound::Kind::Broadcast, kInvalidClientId, packet, options});
+}
+
+void ThreadedServerTransport::disconnect(ClientId id) {
+    queue_outbound({Outbound::Kind::Disconnect, id, {}, {}});
+}
+
+void ThreadedServerTransport::poll(std::uint32_t /*timeoutMs*/) {
+    // Bounded so a flood arriving during the drain cannot starve the tick.
+    Inbound event;
+    for (std::size_t n = inbound_.capacity(); n > 0 && inbound_.try_pop(event); --n) {
+        switch (event.kind) {
+            case Inbound::Kind::Connect:
+                if (onClientConnect) onClientConnect(event.client);
+                break;
+            case Inbound::Kind::Disconnect:
+                if (onClientDisconnect) onClientDisconnect(event.client);
+                break;
+            case Inbound::Kind::Receive:
+                if (onReceive) onReceive(event.client, event.packet.data());
+                break;
+        }
+        event.packet.reset();
+    }
+}
+
+void ThreadedServerTransport::queue_outbound(Outbound&& command) {
+    // Waiting here only happens when the I/O thread is far behind; dropping
+    // would silently lose reliable traffic.
+    while (!outbound_.try_push(std::move(command))) {
+        if (!running_.load(std::memory_order_acquire)) return;
+        std::this_thread::yield();
+    }
+}
+
+// ============================================================================
+// I/O thread side
+// ============================================================================
+
+void ThreadedServerTransport::io_loop() {
+    while (running_.load(std::memory_order_acquire)) {
+        drain_outbound();
+        flush_pending_inbound();
+
+        if (pendingInbound_.size() >= inbound_.capacity()) {
+            // Game thread is behind: leave new traffic in the socket buffers.
+            std::this_thread::yield();
+            continue;
+        }
+        inner_->poll(pendingInbound_.empty() ? config_.pollTimeoutMs : 0);
+    }
+
+    // Hand the final sends (e.g. disconnect notices) to the inner transport.
+    drain_outbound();
+}
+
+void ThreadedServerTransport::drain_outbound() {
+    Outbound command;
+    while (outbound_.try_pop(command)) {
+        switch (command.kind) {
+            case Outbound::Kind::Send:
+                inner_->send_packet(command.client, command.packet, command.options);
+                break;
+            case Outbound::Kind::Broadcast:
+                inner_->broadcast_packet(command.packet, command.options);
+                break;
+            case Outbound::Kind::Disconnect:
+                inner_->disconnect(command.client);
+                break;
+        }
+        command.packet.reset();
+    }
+}
+
+void ThreadedServerTransport::queue_inbound(Inbound&& event) {
+    // Keep ordering: nothing may overtake events already waiting.
+    if (pendingInbound_.empty() && inbound_.try_push(std::move(event))) return;
+    pendingInbound_.push_back(std::move(event));
+}
+
+void ThreadedServerTransport::flush_pending_inbound() {
+    while (!pendingInbound_.empty() && inbound_.try_push(std::move(pendingInbound_.front()))) {
+        pendingInbound_.pop_front();
+    }
+}
+
+} // namespace engine::transport
@@ -0,0 +1,103 @@
+#pragma once
+
+// =============================================================================
+// ThreadedServerTransport - Runs another server transport on an I/O thread
+// The wrapped transport is only touched by the I/O thread, which polls it
+// continuously. Received packets and connection events cross to the game
+// thread through a lock-free ring and are delivered from poll(), so a tick
+// sees network traffic at one fixed point and never services sockets itself.
+// Outgoing sends are queued back to the I/O thread the same way.
+// =============================================================================
+
+#include "transport.hpp"
+#include "engine/core/export.hpp"
+#include "engine/core/lockfree_queue.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <thread>
+
+namespace engine::transport {
+
+class RAYFLOW_CORE_API ThreadedServerTransport : public IServerTransport {
+public:
+    struct Config {
+        /// Slots in each direction. A full outgoing queue makes senders wait
+        /// for the I/O thread; a full incoming queue pauses socket polling.
+        std::size_t queueCapacity = 8192;
+
+        /// How long the I/O thread blocks in the inner poll when idle.
+        std::uint32_t pollTimeoutMs = 1;
+    };
+
+    /// inner must already be started and must not be used by anyone else
+    /// while this transport is running.
+    explicit ThreadedServerTransport(std::shared_ptr<IServerTransport> inner);
+    ThreadedServerTransport(std::shared_ptr<IServerTransport> inner, const Config& config);
+    ~ThreadedServerTransport() override;
+
+    ThreadedServerTransport(const ThreadedServerTransport&) = delete;
+    ThreadedServerTransport& operator=(const ThreadedServerTransport&) = delete;
+
+    /// Start the I/O thread.
+    void start();
+
+    /// Flush queued sends to the inner transport and join the I/O thread.
+    /// Stop the inner transport only after this returns.
+    void stop();
+
+    bool is_running() const { return running_.load(std::memory_order_acquire); }
+
+    // --- IServerTransport implementation ---
+    // Sends and disconnects are queued; disconnect callbacks for them arrive
+    // from a later poll() like any other disconnect.
+
+    void send(ClientId id, std::span<const std::uint8_t> data, SendOptions options = {}) override;
+    void broadcast(std::span<const std::uint8_t> data, SendOptions options = {}) override;
+    void send_packet(ClientId id, const PacketRef& packet, SendOptions options = {}) override;
+    void broadcast_packet(const PacketRef& packet, SendOptions options = {}) override;
+    void disconnect(ClientId id) override;
+
+    /// Deliver the events received since the last call on the calling thread.
+    /// Never blocks; timeoutMs is ignored.
+    void poll(std::uint32_t timeoutMs = 0) override;
+
+private:
+    struct Inbound {
+        enum class Kind : std::uint8_t { Connect, Disconnect, Receive };
+        Kind kind{Kind::Receive};
+        ClientId client{kInvalidClientId};
+        PacketRef packet;
+    };
+
+    struct Outbound {
+        enum class Kind : std::uint8_t { Send, Broadcast, Disconnect };
+        Kind kind{Kind::Send};
+        ClientId client{kInvalidClientId};
+        PacketRef packet;
+        SendOptions options{};
+    };
+
+    void io_loop();
+    void drain_outbound();
+    void queue_inbound(Inbound&& event);
+    void flush_pending_inbound();
+    void queue_outbound(Outbound&& command);
+
+    Config config_;
+    std::shared_ptr<IServerTransport> inner_;
+
+    SpscQueue<Inbound> inbound_;     // I/O thread -> game thread
+    MpscQueue<Outbound> outbound_;   // any game thread -> I/O thread
+
+    // I/O thread only: events that did not fit in inbound_, in order.
+    std::deque<Inbound> pendingInbound_;
+
+    std::thread ioThread_;
+    std::atomic<bool> running_{false};
+};
+
+} // namespace engine::transport
@@ -6,6 +6,8 @@
 // =============================================================================
 
 #include "engine/core/export.hpp"
+#include "engine/core/packet_pool.hpp"
+#include "engine/core/types.hpp"
 
 #include <cstdint>
 #include <functional>
@@ -14,6 +16,25 @@
 
 namespace engine::transport {
 
+// --- Delivery ---
+
+/// Ordering and sequencing hold per channel, so unreliable traffic gets its own
+/// channel and never waits behind a reliable retransmission.
+enum class Channel : std::uint8_t {
+    Reliable = 0,
+    Unreliable = 1,
+};
+
+struct SendOptions {
+    Delivery delivery{Delivery::ReliableOrdered};
+    Channel channel{Channel::Reliable};
+
+    /// Delivery on its default channel.
+    static constexpr SendOptions for_delivery(Delivery d) {
+        return {d, d == Delivery::ReliableOrdered ? Channel::Reliable : Channel::Unreliable};
+    }
+};
+
 /// Callback for received data.
 using OnReceiveCallback = std::function<void(std::span<const std::uint8_t> data)>;
 
@@ -28,7 +49,7 @@ public:
     virtual ~IClientTransport() = default;
 
     /// Send raw data to the server.
-    virtual void send(std::span<const std::uint8_t> data) = 0;
+    virtual void send(std::span<const std::uint8_t> data, SendOptions options = {}) = 0;
     
     /// Poll for network events. Must be called every frame.
     /// @param timeoutMs 0 for non-blocking.
@@ -66,10 +87,20 @@ public:
     virtual ~IServerTransport() = default;
 
     /// Send raw data to a specific client.
-    virtual void send(ClientId id, std::span<const std::uint8_t> data) = 0;
+    virtual void send(ClientId id, std::span<const std::uint8_t> data, SendOptions options = {}) = 0;
     
     /// Broadcast raw data to all connected clients.
-    virtual void broadcast(std::span<const std::uint8_t> data) = 0;
+    virtual void broadcast(std::span<const std::uint8_t> data, SendOptions options = {}) = 0;
+    
+    /// Send a pooled packet. Transports that can reference the buffer until the
+    /// network layer is done with it skip the copy; the default goes through send().
+    virtual void send_packet(ClientId id, const PacketRef& packet, SendOptions options = {}) {
+        send(id, packet.data(), options);
+    }
+    
+    virtual void broadcast_packet(const PacketRef& packet, SendOptions options = {}) {
+        broadcast(packet.data(), options);
+    }
     
     /// Poll for network events. Must be called every tick.
     /// @param timeoutMs 0 for non-blocking.
@@ -2,10 +2,13 @@
 // Full network server using ENet transport
 
 #include <engine/core/server_engine.hpp>
+#include <engine/core/match_host.hpp>
 #include <engine/transport/enet_server.hpp>
+#include <engine/transport/threaded_transport.hpp>
 #include <engine/vfs/vfs.hpp>
 #include "../server/bedwars_server.hpp"
 
+#include <algorithm>
 #include <csignal>
 #include <cstdlib>
 #include <cstring>
@@ -43,11 +46,21 @@ void print_usage(const char* progname) {
     std::cout << "Usage: " << progname << " [options]\n\n";
     std::cout << "Options:\n";
     std::cout << "  --port <port>       Listen port (default: 7777)\n";
-    std::cout << "  --max-players <n>   Maximum players (default: 16)\n";
+    std::cout << "  --max-players <n>   Maximum players per match (default: 16)\n";
+    std::cout << "  --matches <n>       Independent matches hosted in this process (default: 1)\n";
+    std::cout << "  --workers <n>       Worker threads for multi-match ticking (default: auto)\n";
+    std::cout << "  --sim-workers <n>   Extra threads for player movement in each match (default: 0)\n";
     std::cout << "  --tickrate <n>      Server tick rate (default: 30)\n";
+    std::cout << "  --net-thread        Service the network on a dedicated I/O thread\n";
+    std::cout << "  --tick-wait <mode>  Tick pacing: sleep, spin or timer (default: spin)\n";
+    std::cout << "  --max-catchup <n>   Overdue ticks run back to back after a stall (default: 5)\n";
     std::cout << "  --seed <n>          World seed (default: 12345)\n";
     std::cout << "  --map <name>        Map file to load (default: most recent)\n";
     std::cout << "  --editor            Enable editor camera mode\n";
+    std::cout << "  --profile           Enable tick profiler (periodic per-phase timings)\n";
+    std::cout << "  --profile-out <f>   Append profiler reports to file instead of log\n";
+    std::cout << "  --profile-interval <s>  Seconds between profiler reports (default: 10)\n";
+    std::cout << "  --record <file>     Record a replay log (see bedwars_replay_runner)\n";
     std::cout << "  --help              Show this help message\n";
     std::cout << "\nExample:\n";
     std::cout << "  " << progname << " --port 7777 --map arena.rfmap\n";
@@ -56,10 +69,19 @@ void print_usage(const char* progname) {
 struct Args {
     std::uint16_t port = 7777;
     std::size_t maxPlayers = 16;
+    std::size_t matches = 1;
+    std::size_t workers = 0;
+    std::size_t simWorkers = 0;
     std::uint32_t tickRate = 30;
+    bool netThread = false;
+    engine::TickScheduler::Policy scheduling;
     std::uint32_t seed = 12345;
     std::string mapName;
     bool editorMode = false;
+    bool profile = false;
+    std::string profileOut;
+    float profileInterval = 10.0f;
+    std::string recordPath;
     bool help = false;
 };
 
@@ -78,9 +100,36 @@ Args parse_args(int argc, char* argv[]) {
         else if (std::strcmp(arg, "--max-players") == 0 && i + 1 < argc) {
             args.maxPlayers = static_cast<std::size_t>(std::atoi(argv[++i]));
         }
+        else if (std::strcmp(arg, "--matches") == 0 && i + 1 < argc) {
+            args.matches = static_cast<std::size_t>(std::max(1, std::atoi(argv[++i])));
+        }
+        else if (std::strcmp(arg, "--workers") == 0 && i + 1 < argc) {
+            args.workers = static_cast<std::size_t>(std::max(0, std::atoi(argv[++i])));
+        }
+        else if (std::strcmp(arg, "--sim-workers") == 0 && i + 1 < argc) {
+            args.simWorkers = static_cast<std::size_t>(std::max(0, std::atoi(argv[++i])));
+        }
         else if (std::strcmp(arg, "--tickrate") == 0 && i + 1 < argc) {
             args.tickRate = static_cast<std::uint32_t>(std::atoi(argv[++i]));
         }
+        else if (std::strcmp(arg, "--net-thread") == 0) {
+            args.netThread = true;
+        }
+        else if (std::strcmp(arg, "--tick-wait") == 0 && i + 1 < argc) {
+            const char* mode = argv[++i];
+            if (std::strcmp(mode, "sleep") == 0) {
+                args.scheduling.waitMode = engine::TickScheduler::WaitMode::Sleep;
+            } else if (std::strcmp(mode, "spin") == 0) {
+                args.scheduling.waitMode = engine::TickScheduler::WaitMode::SleepSpin;
+            } else if (std::strcmp(mode, "timer") == 0) {
+                args.scheduling.waitMode = engine::TickScheduler::WaitMode::AbsoluteTimer;
+            } else {
+                std::cerr << "[WARNING] Unknown tick wait mode: " << mode << "\n";
+            }
+        }
+        else if (std::strcmp(arg, "--max-catchup") == 0 && i + 1 < argc) {
+            args.scheduling.maxCatchUpTicks = static_cast<std::uint32_t>(std::max(1, std::atoi(argv[++i])));
+        }
         else if (std::strcmp(arg, "--seed") == 0 && i + 1 < argc) {
             args.seed = static_cast<std::uint32_t>(std::atoi(argv[++i]));
         }
@@ -90,6 +139,19 @@ Args parse_args(int argc, char* argv[]) {
         else if (std::strcmp(arg, "--editor") == 0) {
             args.editorMode = true;
         }
+        else if (std::strcmp(arg, "--profile") == 0) {
+            args.profile = true;
+        }
+        else if (std::strcmp(arg, "--profile-out") == 0 && i + 1 < argc) {
+            args.profile = true;
+            args.profileOut = argv[++i];
+        }
+        else if (std::strcmp(arg, "--profile-interval") == 0 && i + 1 < argc) {
+            args.profileInterval = static_cast<float>(std::atof(argv[++i]));
+        }
+        else if (std::strcmp(arg, "--record") == 0 && i + 1 < argc) {
+            args.recordPath = argv[++i];
+        }
         else {
             std::cerr << "[WARNING] Unknown argument: " << arg << "\n";
         }
@@ -98,6 +160,54 @@ Args parse_args(int argc, char* argv[]) {
     return args;
 }
 
+bedwars::server::BedWarsServer::Options make_game_options(const Args& args) {
+    bedwars::server::BedWarsServer::Options opts;
+    opts.editorCameraMode = args.editorMode;
+    opts.autoStartMatch = !args.editorMode;  // Don't auto-start in editor mode
+    opts.mapName = args.mapName;
+    opts.simulationWorkers = args.simWorkers;
+    return opts;
+}
+
+// Multi-match mode: one ENet host, N BedWarsServer instances ticked on a worker pool.
+int run_match_host(const Args& args,
+                   const std::shared_ptr<engine::transport::IServerTransport>& transport,
+                   const engine::transport::ENetServerTransport& enet) {
+    engine::MatchHost::Config config;
+    config.tickRate = static_cast<float>(args.tickRate);
+    config.workerThreads = args.workers;
+    config.maxPlayersPerMatch = args.maxPlayers;
+    config.scheduling = args.scheduling;
+    
+    engine::MatchHost host(config);
+    host.set_transport(transport);
+    
+    const auto opts = make_game_options(args);
+    for (std::size_t i = 0; i < args.matches; ++i) {
+        // Distinct seeds keep procedural fallback worlds independent
+        host.add_match(std::make_unique<bedwars::server::BedWarsServer>(
+            args.seed + static_cast<std::uint32_t>(i), opts));
+    }
+    
+    std::cout << "[INFO] Hosting " << args.matches << " matches on port " << args.port << "\n";
+    std::cout << "[INFO] Max players per match: " << args.maxPlayers << "\n";
+    std::cout << "[INFO] Tick rate: " << args.tickRate << " TPS\n";
+    std::cout << "[INFO] Press Ctrl+C to stop\n\n";
+    
+    std::thread serverThread([&]() {
+        host.run();
+    });
+    
+    while (g_running && enet.is_running()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    
+    std::cout << "\n[INFO] Shutting down...\n";
+    host.stop();
+    serverThread.join();
+    return 0;
+}
+
 } // namespace
 
 int main(int argc, char* argv[]) {
@@ -125,39 +235,77 @@ int main(int argc, char* argv[]) {
     }
     
     // Create ENet server transport
-    auto transport = std::make_shared<engine::transport::ENetServerTransport>();
+    auto enet = std::make_shared<engine::transport::ENetServerTransport>();
     
-    if (!transport->start(args.port, args.maxPlayers)) {
+    if (!enet->start(args.port, args.maxPlayers * args.matches)) {
         std::cerr << "[ERROR] Failed to start server on port " << args.port << "\n";
         return 1;
     }
     
-    // Create game server with options
-    bedwars::server::BedWarsServer::Options opts;
-    opts.editorCameraMode = args.editorMode;
-    opts.autoStartMatch = !args.editorMode;  // Don't auto-start in editor mode
-    opts.mapName = args.mapName;
+    // Optionally move socket servicing off the tick thread
+    std::shared_ptr<engine::transport::IServerTransport> transport = enet;
+    std::shared_ptr<engine::transport::ThreadedServerTransport> netThread;
+    if (args.netThread) {
+        netThread = std::make_shared<engine::transport::ThreadedServerTransport>(enet);
+        netThread->start();
+        transport = netThread;
+    }
     
-    bedwars::server::BedWarsServer game(args.seed, opts);
+    // The I/O thread must be gone before ENet is torn down
+    auto stop_transport = [&]() {
+        if (netThread) {
+            netThread->stop();
+        }
+        enet->stop();
+    };
+    
+    // Set up signal handlers
+    std::signal(SIGINT, signal_handler);
+    std::signal(SIGTERM, signal_handler);
+    
+    if (args.matches > 1) {
+        if (!args.recordPath.empty()) {
+            std::cerr << "[WARNING] --record is only supported with a single match; not recording\n";
+        }
+        if (args.profile) {
+            std::cerr << "[WARNING] --profile is only supported with a single match; not profiling\n";
+        }
+        const int rc = run_match_host(args, transport, *enet);
+        stop_transport();
+        engine::vfs::shutdown();
+        std::cout << "[INFO] Server stopped\n";
+        return rc;
+    }
+    
+    // Create game server with options
+    bedwars::server::BedWarsServer game(args.seed, make_game_options(args));
     
     // Create and configure engine
     engine::ServerEngine::Config config;
     config.tickRate = static_cast<float>(args.tickRate);
+    config.scheduling = args.scheduling;
+    config.profiling = args.profile;
+    config.profileDumpPath = args.profileOut;
+    config.profileDumpIntervalSec = args.profileInterval;
+    config.replayPath = args.recordPath;
     
     engine::ServerEngine engine(config);
     engine.set_transport(transport);
     
-    // Set up signal handlers
-    std::signal(SIGINT, signal_handler);
-    std::signal(SIGTERM, signal_handler);
-    
     std::cout << "[INFO] Server started on port " << args.port << "\n";
     std::cout << "[INFO] Max players: " << args.maxPlayers << "\n";
     std::cout << "[INFO] Tick rate: " << args.tickRate << " TPS\n";
     std::cout << "[INFO] World seed: " << args.seed << "\n";
+    if (netThread) {
+        std::cout << "[INFO] Network I/O thread: ENABLED\n";
+    }
     if (args.editorMode) {
         std::cout << "[INFO] Editor mode: ENABLED\n";
     }
+    if (args.profile) {
+        std::cout << "[INFO] Tick profiler: ENABLED"
+                  << (args.profileOut.empty() ? "" : " (" + args.profileOut + ")") << "\n";
+    }
     std::cout << "[INFO] Press Ctrl+C to stop\n\n";
     
     // Run in background thread so we can check g_running
@@ -166,14 +314,14 @@ int main(int argc, char* argv[]) {
     });
     
     // Main wait loop
-    while (g_running && transport->is_running()) {
+    while (g_running && enet->is_running()) {
         std::this_thread::sleep_for(std::chrono::milliseconds(100));
     }
     
     std::cout << "\n[INFO] Shutting down...\n";
     engine.stop();
-    transport->stop();
     serverThread.join();
+    stop_transport();
     engine::vfs::shutdown();
     std::cout << "[INFO] Server stopped\n";
     
@@ -1,6 +1,9 @@
 #include "bedwars_client.hpp"
 #include "scripting/client_script_engine.hpp"
 #include "../shared/protocol/serialization.hpp"
+#include "../shared/protocol/chunk_codec.hpp"
+#include "../shared/protocol/snapshot_codec.hpp"
+#include "../shared/physics/physics_utils.hpp"
 
 // Engine subsystems are accessed through IClientServices
 #include "engine/modules/voxel/client/world.hpp"
@@ -27,6 +30,7 @@
 
 #include <glm/gtc/constants.hpp>
 #include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
 
@@ -163,26 +167,34 @@ void BedWarsClient::on_update(float dt) {
             clear_player_input();
         }
         
-        // Send input to server
-        send_input_frame();
+        // Send input to server: one frame per server tick, since the server
+        // simulates every frame it receives exactly once
+        constexpr int kMaxInputsPerFrame = 4;
+        const float inputDt = 1.0f / static_cast<float>(tickRate_ > 0 ? tickRate_ : 30);
+        inputAccumulator_ += dt;
+        int inputsSent = 0;
+        while (inputAccumulator_ >= inputDt && inputsSent < kMaxInputsPerFrame) {
+            send_input_frame();
+            inputAccumulator_ -= inputDt;
+            ++inputsSent;
+        }
+        if (inputsSent == kMaxInputsPerFrame) {
+            inputAccumulator_ = 0.0f;  // Long hitch: don't flood the server
+        }
         
-        // Interpolate player position to server target each frame
-        if (playerEntity_ != entt::null && registry_.all_of<ecs::Transform>(playerEntity_)) {
-            auto& transform = registry_.get<ecs::Transform>(playerEntity_);
-            
-            // Frame-rate independent interpolation using exponential decay
-            // speed=20 gives snappy movement (~95% convergence in ~0.15s)
-            constexpr float kInterpSpeed = 20.0f;
-            const float alpha = (dt <= 0.0f) ? 1.0f : (1.0f - std::exp(-kInterpSpeed * dt));
-            
-            transform.position.x += (localPlayer_.targetPx - transform.position.x) * alpha;
-            transform.position.y += (localPlayer_.targetPy - transform.position.y) * alpha;
-            transform.position.z += (localPlayer_.targetPz - transform.position.z) * alpha;
-            
-            // Also update localPlayer current position for consistency
-            localPlayer_.px = transform.position.x;
-            localPlayer_.py = transform.position.y;
-            localPlayer_.pz = transform.position.z;
+        // Place the local player at its predicted position
+        update_local_player_transform(dt);
+        
+        // Other players ease toward their latest replicated position the same way
+        {
+            constexpr float kRemoteInterpSpeed = 15.0f;
+            const float alpha = (dt <= 0.0f) ? 1.0f : (1.0f - std::exp(-kRemoteInterpSpeed * dt));
+            for (auto& [id, player] : players_) {
+                if (!player.inView) continue;
+                player.px += (player.targetPx - player.px) * alpha;
+                player.py += (player.targetPy - player.py) * alpha;
+                player.pz += (player.targetPz - player.pz) * alpha;
+            }
         }
         
         // Update world chunks around player
@@ -396,6 +408,7 @@ void BedWarsClient::render_players(const rf::Camera& camera) {
 
     for (const auto& [id, player] : players_) {
         if (id == localPlayerId_) continue;  // Don't render self
+        if (!player.inView) continue;        // Outside interest range: position is stale
 
         rf::Color color = get_team_color(player.team);
         if (!player.alive) {
@@ -590,6 +603,11 @@ void BedWarsClient::on_disconnected() {
     localPlayerId_ = 0;
     players_.clear();
     items_.clear();
+    entitySnapshots_.clear();
+    lastEntitySnapshotTick_ = 0;
+    pendingInputs_.clear();
+    predictionValid_ = false;
+    inputAccumulator_ = 0.0f;
 }
 
 void BedWarsClient::on_server_message(std::span<const std::uint8_t> data) {
@@ -619,6 +637,9 @@ void BedWarsClient::handle_message(const proto::Message& msg) {
         else if constexpr (std::is_same_v<T, proto::StateSnapshot>) {
             handle_state_snapshot(m);
         }
+        else if constexpr (std::is_same_v<T, proto::EntitySnapshot>) {
+            handle_entity_snapshot(m);
+        }
         else if constexpr (std::is_same_v<T, proto::ChunkData>) {
             handle_chunk_data(m);
         }
@@ -628,6 +649,9 @@ void BedWarsClient::handle_message(const proto::Message& msg) {
         else if constexpr (std::is_same_v<T, proto::BlockBroken>) {
             handle_block_broken(m);
         }
+        else if constexpr (std::is_same_v<T, proto::WorldDelta>) {
+            handle_world_delta(m);
+        }
         else if constexpr (std::is_same_v<T, proto::ActionRejected>) {
             handle_action_rejected(m);
         }
@@ -652,6 +676,9 @@ void BedWarsClient::handle_message(const proto::Message& msg) {
         else if constexpr (std::is_same_v<T, proto::ItemPickedUp>) {
             handle_item_picked_up(m);
         }
+        else if constexpr (std::is_same_v<T, proto::ItemCountChanged>) {
+            handle_item_count_changed(m);
+        }
     }, msg);
 }
 
@@ -679,9 +706,11 @@ void BedWarsClient::handle_server_hello(const proto::ServerHello& msg) {
         
         engine_->log(engine::LogLevel::Info, "Looking for map at: " + path.string());
         
-        shared::maps::MapTemplate mapTemplate;
+        // Shared cache: an in-process server that loaded the same file hands back its instance
         std::string err;
-        if (auto* world = engine_->world(); world && shared::maps::read_rfmap(path, &mapTemplate, &err)) {
+        auto* world = engine_->world();
+        auto mapTemplate = world ? shared::maps::read_rfmap_shared(path, &err) : nullptr;
+        if (world && mapTemplate) {
             // Apply map template to world
             world->set_map_template(std::move(mapTemplate));
             
@@ -731,18 +760,21 @@ void BedWarsClient::handle_state_snapshot(const proto::StateSnapshot& msg) {
     
     // Update local player position from server (authoritative)
     if (msg.playerId == localPlayerId_) {
-        // Store target position for interpolation (done each frame in on_update)
+        // Authoritative position; what we render is the prediction built on it
         localPlayer_.targetPx = msg.px;
         localPlayer_.targetPy = msg.py;
         localPlayer_.targetPz = msg.pz;
-        localPlayer_.vx = msg.vx;
-        localPlayer_.vy = msg.vy;
-        localPlayer_.vz = msg.vz;
+        
+        reconcile_local_player(msg);
+        
+        localPlayer_.vx = predicted_.vx;
+        localPlayer_.vy = predicted_.vy;
+        localPlayer_.vz = predicted_.vz;
         
         // Update velocity in ECS
         if (playerEntity_ != entt::null && registry_.all_of<ecs::Velocity>(playerEntity_)) {
             auto& vel = registry_.get<ecs::Velocity>(playerEntity_);
-            vel.linear = {msg.vx, msg.vy, msg.vz};
+            vel.linear = {predicted_.vx, predicted_.vy, predicted_.vz};
         }
     } else {
         // Other player update
@@ -757,10 +789,65 @@ void BedWarsClient::handle_state_snapshot(const proto::StateSnapshot& msg) {
     }
 }
 
+void BedWarsClient::handle_entity_snapshot(const proto::EntitySnapshot& msg) {
+    namespace sc = proto::snapshot_codec;
+    
+    // Unreliable channel: ignore anything older than what we already decoded
+    if (msg.serverTick <= lastEntitySnapshotTick_) return;
+    
+    const sc::EntityList* baseline = entitySnapshots_.find(msg.baselineTick);
+    sc::EntityList decoded;
+    if (!sc::apply_delta(msg, baseline, decoded)) {
+        // Baseline no longer held: keep acking the old tick until the server resends in full
+        return;
+    }
+    
+    for (auto& [id, player] : players_) {
+        player.inView = false;
+    }
+    for (const auto& e : decoded) {
+        auto& player = players_[e.id];
+        const bool wasHidden = player.playerId != e.id || !player.inView;
+        player.playerId = e.id;
+        player.targetPx = sc::dequantize_position(e.x);
+        player.targetPy = sc::dequantize_position(e.y);
+        player.targetPz = sc::dequantize_position(e.z);
+        if (wasHidden) {
+            // Entering view: snap instead of sliding in from a stale position
+            player.px = player.targetPx;
+            player.py = player.targetPy;
+            player.pz = player.targetPz;
+        }
+        player.yaw = sc::dequantize_yaw(e.yaw);
+        player.pitch = sc::dequantize_pitch(e.pitch);
+        player.team = e.team;
+        player.alive = (e.flags & proto::EntitySnapshot::kFlagAlive) != 0;
+        player.inView = true;
+    }
+    
+    entitySnapshots_.store(msg.serverTick) = std::move(decoded);
+    lastEntitySnapshotTick_ = msg.serverTick;
+}
+
 void BedWarsClient::handle_chunk_data(const proto::ChunkData& msg) {
-    if (auto* world = engine_->world()) {
+    auto* world = engine_->world();
+    if (!world) return;
+    
+    if (!msg.deltaFromTemplate) {
         world->apply_chunk_data(msg.chunkX, msg.chunkZ, msg.blocks);
+        return;
+    }
+    
+    // Resolve unchanged cells from our copy of the map template
+    std::vector<std::uint8_t> blocks = msg.blocks;
+    std::span<const std::uint8_t> base;
+    if (const auto* tmpl = world->map_template()) {
+        if (const auto* chunk = tmpl->find_chunk(msg.chunkX, msg.chunkZ)) {
+            base = {reinterpret_cast<const std::uint8_t*>(chunk->blocks.data()), chunk->blocks.size()};
+        }
     }
+    proto::chunk_codec::apply_delta(blocks, base);
+    world->apply_chunk_data(msg.chunkX, msg.chunkZ, blocks);
 }
 
 void BedWarsClient::handle_block_placed(const proto::BlockPlaced& msg) {
@@ -788,6 +875,34 @@ void BedWarsClient::handle_block_broken(const proto::BlockBroken& msg) {
     }
 }
 
+void BedWarsClient::handle_world_delta(const proto::WorldDelta& msg) {
+    auto* world = engine_->world();
+    if (!world) return;
+    
+    std::size_t count = 0;
+    for (const auto& chunk : msg.chunks) {
+        const int baseX = chunk.chunkX * shared::voxel::CHUNK_WIDTH;
+        const int baseZ = chunk.chunkZ * shared::voxel::CHUNK_DEPTH;
+        for (const auto& b : chunk.blocks) {
+            const int x = baseX + (b.localIndex & 15);
+            const int z = baseZ + ((b.localIndex >> 4) & 15);
+            const int y = b.localIndex >> 8;
+            world->set_block(x, y, z, static_cast<voxel::Block>(b.blockType));
+            if (b.stateByte != 0) {
+                world->set_block_state(x, y, z, shared::voxel::BlockRuntimeState::from_byte(b.stateByte));
+            }
+        }
+        count += chunk.blocks.size();
+    }
+    
+    if (msg.final) {
+        engine_->log(engine::LogLevel::Info, "World sync complete");
+    } else {
+        engine_->log(engine::LogLevel::Debug, "WorldDelta: " + std::to_string(count) + " blocks in " +
+                     std::to_string(msg.chunks.size()) + " chunks");
+    }
+}
+
 void BedWarsClient::handle_action_rejected(const proto::ActionRejected& msg) {
     engine_->log(engine::LogLevel::Warning, 
                  "Action rejected, seq=" + std::to_string(msg.seq) + 
@@ -850,12 +965,13 @@ void BedWarsClient::handle_player_respawned(const proto::PlayerRespawned& msg) {
         localPlayer_.px = msg.x;
         localPlayer_.py = msg.y;
         localPlayer_.pz = msg.z;
+        reset_prediction(msg.x, msg.y, msg.z);
     } else {
         auto& player = players_[msg.playerId];
         player.alive = true;
-        player.px = msg.x;
-        player.py = msg.y;
-        player.pz = msg.z;
+        player.px = player.targetPx = msg.x;
+        player.py = player.targetPy = msg.y;
+        player.pz = player.targetPz = msg.z;
     }
 }
 
@@ -885,6 +1001,137 @@ void BedWarsClient::handle_item_picked_up(const proto::ItemPickedUp& msg) {
     items_.erase(msg.entityId);
 }
 
+void BedWarsClient::handle_item_count_changed(const proto::ItemCountChanged& msg) {
+    auto it = items_.find(msg.entityId);
+    if (it != items_.end()) {
+        it->second.count = msg.count;
+    }
+}
+
+// ============================================================================
+// Prediction
+// ============================================================================
+
+namespace {
+
+constexpr std::size_t kMaxPendingInputs = 128;   // ~4 s at 30 TPS
+constexpr float kPredictionSnapDistance = 4.0f;  // Larger corrections teleport
+constexpr float kPredictionErrorDecay = 12.0f;   // Error smoothing rate (1/s)
+
+// Signed distance a - b on the wrapping input seq space.
+std::int32_t input_seq_diff(std::uint32_t a, std::uint32_t b) {
+    return static_cast<std::int32_t>(a - b);
+}
+
+} // namespace
+
+void BedWarsClient::predict_input(const proto::InputFrame& input) {
+    pendingInputs_.push_back(input);
+    if (pendingInputs_.size() > kMaxPendingInputs) {
+        pendingInputs_.pop_front();
+    }
+    
+    auto* world = engine_->world();
+    if (!predictionValid_ || !localPlayer_.alive || !world) return;
+    
+    // Same step, dt and input the server will run for this seq
+    predictedPrev_ = predicted_;
+    auto& s = predicted_;
+    physics::simulate_physics_step(
+        *world,
+        s.px, s.py, s.pz,
+        s.vx, s.vy, s.vz,
+        s.onGround, s.lastJumpHeld,
+        input.moveX, input.moveY, input.yaw,
+        input.jump, input.sprint,
+        1.0f / static_cast<float>(tickRate_ > 0 ? tickRate_ : 30)
+    );
+}
+
+void BedWarsClient::reconcile_local_player(const proto::StateSnapshot& msg) {
+    // The server has simulated everything up to lastInputSeq
+    while (!pendingInputs_.empty() && input_seq_diff(pendingInputs_.front().seq, msg.lastInputSeq) <= 0) {
+        pendingInputs_.pop_front();
+    }
+    
+    const PredictedState before = predicted_;
+    const bool hadPrediction = predictionValid_;
+    
+    // Rewind to the server state at the acked seq...
+    predicted_.px = msg.px;
+    predicted_.py = msg.py;
+    predicted_.pz = msg.pz;
+    predicted_.vx = msg.vx;
+    predicted_.vy = msg.vy;
+    predicted_.vz = msg.vz;
+    predicted_.onGround = (msg.flags & proto::StateSnapshot::kFlagOnGround) != 0;
+    predicted_.lastJumpHeld = (msg.flags & proto::StateSnapshot::kFlagJumpHeld) != 0;
+    predictionValid_ = true;
+    
+    // ...and replay what it has not seen yet
+    auto* world = engine_->world();
+    if (localPlayer_.alive && world) {
+        const float stepDt = 1.0f / static_cast<float>(tickRate_ > 0 ? tickRate_ : 30);
+        for (const auto& input : pendingInputs_) {
+            auto& s = predicted_;
+            physics::simulate_physics_step(
+                *world,
+                s.px, s.py, s.pz,
+                s.vx, s.vy, s.vz,
+                s.onGround, s.lastJumpHeld,
+                input.moveX, input.moveY, input.yaw,
+                input.jump, input.sprint,
+                stepDt
+            );
+        }
+    }
+    
+    // Keep the rendered position continuous: the difference becomes an offset
+    // that fades out, unless it is large enough to be a teleport
+    const rf::Vec3 correction{before.px - predicted_.px, before.py - predicted_.py, before.pz - predicted_.pz};
+    if (!hadPrediction || glm::dot(correction, correction) > kPredictionSnapDistance * kPredictionSnapDistance) {
+        predictionError_ = {0.0f, 0.0f, 0.0f};
+        predictedPrev_ = predicted_;
+        return;
+    }
+    predictionError_ += correction;
+    predictedPrev_.px -= correction.x;
+    predictedPrev_.py -= correction.y;
+    predictedPrev_.pz -= correction.z;
+}
+
+void BedWarsClient::reset_prediction(float x, float y, float z) {
+    predicted_ = PredictedState{};
+    predicted_.px = x;
+    predicted_.py = y;
+    predicted_.pz = z;
+    predictedPrev_ = predicted_;
+    predictionError_ = {0.0f, 0.0f, 0.0f};
+    pendingInputs_.clear();
+    predictionValid_ = true;
+}
+
+void BedWarsClient::update_local_player_transform(float dt) {
+    if (!predictionValid_ || playerEntity_ == entt::null || !registry_.all_of<ecs::Transform>(playerEntity_)) return;
+    
+    // Predicted steps happen at tick rate: blend the last two by the time
+    // accumulated toward the next one
+    const float inputDt = 1.0f / static_cast<float>(tickRate_ > 0 ? tickRate_ : 30);
+    const float t = std::clamp(inputAccumulator_ / inputDt, 0.0f, 1.0f);
+    
+    predictionError_ *= (dt <= 0.0f) ? 1.0f : std::exp(-kPredictionErrorDecay * dt);
+    
+    auto& transform = registry_.get<ecs::Transform>(playerEntity_);
+    transform.position.x = predictedPrev_.px + (predicted_.px - predictedPrev_.px) * t + predictionError_.x;
+    transform.position.y = predictedPrev_.py + (predicted_.py - predictedPrev_.py) * t + predictionError_.y;
+    transform.position.z = predictedPrev_.pz + (predicted_.pz - predictedPrev_.pz) * t + predictionError_.z;
+    
+    // Also update localPlayer current position for consistency
+    localPlayer_.px = transform.position.x;
+    localPlayer_.py = transform.position.y;
+    localPlayer_.pz = transform.position.z;
+}
+
 // ============================================================================
 // Message Sending
 // ============================================================================
@@ -899,6 +1146,9 @@ void BedWarsClient::send_client_hello() {
 
 void BedWarsClient::send_join_match() {
     proto::JoinMatch msg;
+    if (auto* world = engine_->world()) {
+        msg.hasMapTemplate = hasMapTemplate_ && world->has_map_template();
+    }
     send_message(msg);
 }
 
@@ -926,8 +1176,12 @@ void BedWarsClient::send_input_frame() {
     msg.sprint = uiCapturesInput_ ? false : input.sprint_pressed;
     msg.camUp = false;
     msg.camDown = false;
+    msg.ackSnapshotTick = lastEntitySnapshotTick_;
     
-    send_message(msg);
+    // Carries the full input state; the server repeats the previous frame in place of a lost one
+    send_message(msg, engine::Delivery::UnreliableSequenced);
+    
+    predict_input(msg);
 }
 
 void BedWarsClient::send_try_break_block(int x, int y, int z) {
@@ -954,9 +1208,9 @@ void BedWarsClient::send_try_place_block(int x, int y, int z, proto::BlockType t
 }
 
 template<typename T>
-void BedWarsClient::send_message(const T& msg) {
+void BedWarsClient::send_message(const T& msg, engine::Delivery delivery) {
     auto data = proto::serialize(proto::Message{msg});
-    engine_->send(data);
+    engine_->send(data, delivery);
 }
 
 // ============================================================================
@@ -1122,7 +1376,7 @@ void BedWarsClient::update_lights() {
 
     if (lightingConfig_.enable_other_players_light) {
         for (const auto& [id, state] : players_) {
-            if (!state.alive) continue;
+            if (!state.alive || !state.inView) continue;
             
             active_lights.push_back({
                 .position = {state.px, state.py + 1.5f, state.pz},
@@ -13,6 +13,7 @@
 #include "engine/renderer/gl_mesh.hpp"
 
 #include "../shared/protocol/messages.hpp"
+#include "../shared/protocol/snapshot_codec.hpp"
 
 // Forward declaration
 namespace bedwars::scripting {
@@ -23,6 +24,7 @@ class ClientScriptEngine;
 #include "engine/core/math_types.hpp"
 
 #include <cstdint>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <optional>
@@ -76,6 +78,9 @@ struct ClientPlayerState {
     std::uint8_t hp{20};
     std::uint8_t maxHp{20};
     bool alive{true};
+    
+    // Replicated in the latest EntitySnapshot (within the server's interest range)
+    bool inView{false};
 };
 
 /// Team state on client
@@ -142,9 +147,11 @@ private:
     void handle_server_hello(const proto::ServerHello& msg);
     void handle_join_ack(const proto::JoinAck& msg);
     void handle_state_snapshot(const proto::StateSnapshot& msg);
+    void handle_entity_snapshot(const proto::EntitySnapshot& msg);
     void handle_chunk_data(const proto::ChunkData& msg);
     void handle_block_placed(const proto::BlockPlaced& msg);
     void handle_block_broken(const proto::BlockBroken& msg);
+    void handle_world_delta(const proto::WorldDelta& msg);
     void handle_action_rejected(const proto::ActionRejected& msg);
     void handle_team_assigned(const proto::TeamAssigned& msg);
     void handle_health_update(const proto::HealthUpdate& msg);
@@ -153,6 +160,7 @@ private:
     void handle_bed_destroyed(const proto::BedDestroyed& msg);
     void handle_item_spawned(const proto::ItemSpawned& msg);
     void handle_item_picked_up(const proto::ItemPickedUp& msg);
+    void handle_item_count_changed(const proto::ItemCountChanged& msg);
 
     // --- Sending ---
     void send_client_hello();
@@ -163,11 +171,17 @@ private:
     void send_try_place_block(int x, int y, int z, proto::BlockType type, float hitY, std::uint8_t face);
     
     template<typename T>
-    void send_message(const T& msg);
+    void send_message(const T& msg, engine::Delivery delivery = engine::Delivery::ReliableOrdered);
 
     // --- Input ---
     void clear_player_input();
     
+    // --- Prediction (local player) ---
+    void predict_input(const proto::InputFrame& input);
+    void reconcile_local_player(const proto::StateSnapshot& msg);
+    void reset_prediction(float x, float y, float z);
+    void update_local_player_transform(float dt);
+    
     // --- Rendering ---
     void render_players(const rf::Camera& camera);
     void render_items(const rf::Camera& camera);
@@ -210,8 +224,23 @@ private:
     SessionState sessionState_{SessionState::Disconnected};
     
     // Protocol state
-    std::uint32_t inputSeq_{0};
+    std::uint32_t inputSeq_{1};          // 0 is reserved for "none" in StateSnapshot::lastInputSeq
     std::uint32_t actionSeq_{0};
+    float inputAccumulator_{0.0f};       // Inputs go out once per server tick
+    
+    // Local player prediction: the shared physics step runs on every input we
+    // send; server snapshots rewind to the acked seq and replay the rest.
+    struct PredictedState {
+        float px{0.0f}, py{80.0f}, pz{0.0f};
+        float vx{0.0f}, vy{0.0f}, vz{0.0f};
+        bool onGround{false};
+        bool lastJumpHeld{false};
+    };
+    PredictedState predicted_;
+    PredictedState predictedPrev_;                 // One step back, for render interpolation
+    std::deque<proto::InputFrame> pendingInputs_;  // Sent but not yet simulated by the server
+    rf::Vec3 predictionError_{0.0f, 0.0f, 0.0f};   // Visual offset left by a correction, decays to 0
+    bool predictionValid_{false};                  // Seeded from a server snapshot
     
     // Server info
     std::uint32_t tickRate_{30};
@@ -228,6 +257,10 @@ private:
     // Other players
     std::unordered_map<std::uint32_t, ClientPlayerState> players_;
     
+    // Decoded EntitySnapshots (baselines for deltas) and the newest one, acked in InputFrame
+    proto::snapshot_codec::History entitySnapshots_;
+    engine::Tick lastEntitySnapshotTick_{0};
+    
     // Teams
     std::array<ClientTeamState, 4> teams_;
     std::vector<proto::TeamId> availableTeams_;
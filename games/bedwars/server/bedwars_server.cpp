@@ -1,6 +1,7 @@
 #include "bedwars_server.hpp"
-#include "physics_utils.hpp"
+#include "../shared/physics/physics_utils.hpp"
 #include "../shared/protocol/serialization.hpp"
+#include "../shared/protocol/chunk_codec.hpp"
 
 // Terrain (now in bedwars)
 #include "voxel/terrain.hpp"
@@ -16,6 +17,7 @@
 #include <algorithm>
 #include <cmath>
 #include <filesystem>
+#include <limits>
 #include <unordered_set>
 
 namespace bedwars::server {
@@ -28,7 +30,8 @@ inline int fast_floor(float v) {
 }
 
 // Load a specific .rfmap by name from maps directory
-static bool load_rfmap_by_name(const std::string& name, shared::maps::MapTemplate* outMap, std::filesystem::path* outPath) {
+// Maps are loaded through the shared cache so matches in one process share a template
+static bool load_rfmap_by_name(const std::string& name, shared::maps::SharedMapTemplate* outMap, std::filesystem::path* outPath) {
     if (!outMap || name.empty()) return false;
     
     auto mapsDir = shared::maps::runtime_maps_dir();
@@ -44,15 +47,16 @@ static bool load_rfmap_by_name(const std::string& name, shared::maps::MapTemplat
     }
     
     std::string err;
-    if (!shared::maps::read_rfmap(path, outMap, &err)) return false;
-    if (outMap->mapId.empty() || outMap->version == 0) return false;
+    auto map = shared::maps::read_rfmap_shared(path, &err);
+    if (!map || map->mapId.empty() || map->version == 0) return false;
     
+    *outMap = std::move(map);
     if (outPath) *outPath = path;
     return true;
 }
 
 // Load the most recently modified .rfmap from maps directory
-static bool load_latest_rfmap(shared::maps::MapTemplate* outMap, std::filesystem::path* outPath) {
+static bool load_latest_rfmap(shared::maps::SharedMapTemplate* outMap, std::filesystem::path* outPath) {
     if (!outMap) return false;
     
     auto mapsDir = shared::maps::runtime_maps_dir();
@@ -80,9 +84,10 @@ static bool load_latest_rfmap(shared::maps::MapTemplate* outMap, std::filesystem
     if (!haveBest) return false;
     
     std::string err;
-    if (!shared::maps::read_rfmap(bestPath, outMap, &err)) return false;
-    if (outMap->mapId.empty() || outMap->version == 0) return false;
+    auto map = shared::maps::read_rfmap_shared(bestPath, &err);
+    if (!map || map->mapId.empty() || map->version == 0) return false;
     
+    *outMap = std::move(map);
     if (outPath) *outPath = bestPath;
     return true;
 }
@@ -113,6 +118,34 @@ inline bool would_intersect_player(float px, float py, float pz, int bx, int by,
             pMinY < bMaxY && pMaxY > bMinY &&
             pMinZ < bMaxZ && pMaxZ > bMinZ);
 }
+
+// Distance along a unit ray from (ox, oy, oz) to where it enters the player
+// box standing at (px, py, pz) grown by pad; negative if the ray misses.
+// Slab test; a ray starting inside the box hits at 0.
+inline float ray_player_box_distance(float ox, float oy, float oz, float dx, float dy, float dz,
+                                     float px, float py, float pz, float pad) {
+    const float halfW = bedwars::kPlayerWidth * 0.5f + pad;
+    const float lo[3] = {px - halfW, py - pad, pz - halfW};
+    const float hi[3] = {px + halfW, py + bedwars::kPlayerHeight + pad, pz + halfW};
+    const float o[3] = {ox, oy, oz};
+    const float d[3] = {dx, dy, dz};
+    
+    float tNear = 0.0f;
+    float tFar = std::numeric_limits<float>::max();
+    for (int a = 0; a < 3; ++a) {
+        if (std::abs(d[a]) < 1e-6f) {
+            if (o[a] < lo[a] || o[a] > hi[a]) return -1.0f;
+            continue;
+        }
+        float t0 = (lo[a] - o[a]) / d[a];
+        float t1 = (hi[a] - o[a]) / d[a];
+        if (t0 > t1) std::swap(t0, t1);
+        tNear = std::max(tNear, t0);
+        tFar = std::min(tFar, t1);
+        if (tNear > tFar) return -1.0f;
+    }
+    return tNear;
+}
 }
 
 // ============================================================================
@@ -135,8 +168,24 @@ BedWarsServer::~BedWarsServer() = default;
 
 void BedWarsServer::on_init(engine::IEngineServices& engine) {
     engine_ = &engine;
+    
+    // Register tick sub-steps with the engine profiler (if enabled)
+    profiler_ = engine_->profiler();
+    if (profiler_) {
+        phases_.matchPhase = profiler_->register_phase("bedwars.match_phase");
+        phases_.generators = profiler_->register_phase("bedwars.update_generators");
+        phases_.items = profiler_->register_phase("bedwars.update_items");
+        phases_.combat = profiler_->register_phase("bedwars.combat");
+        phases_.simulatePlayers = profiler_->register_phase("bedwars.simulate_players");
+        phases_.snapshots = profiler_->register_phase("bedwars.send_snapshots");
+        phases_.worldSync = profiler_->register_phase("bedwars.world_sync");
+    }
+    
     terrain_ = std::make_unique<::bedwars::voxel::Terrain>(worldSeed_);
     
+    simPool_ = std::make_unique<engine::ThreadPool>(opts_.simulationWorkers);
+    laneClaims_.resize(simPool_->lane_count());
+    
     // Editor mode: empty terrain (no procedural generation)
     if (opts_.editorCameraMode) {
         terrain_->set_void_base(true);
@@ -144,7 +193,7 @@ void BedWarsServer::on_init(engine::IEngineServices& engine) {
     
     // Load map template if enabled
     if (opts_.loadMapTemplate) {
-        shared::maps::MapTemplate map;
+        shared::maps::SharedMapTemplate map;
         std::filesystem::path path;
         bool loaded = false;
         
@@ -163,11 +212,11 @@ void BedWarsServer::on_init(engine::IEngineServices& engine) {
         
         if (loaded) {
             hasMapTemplate_ = true;
-            mapId_ = map.mapId;
-            mapVersion_ = map.version;
+            mapId_ = map->mapId;
+            mapVersion_ = map->version;
             
             // Calculate spawn position from map bounds (center of the map, find ground level)
-            const auto& bounds = map.bounds;
+            const auto& bounds = map->bounds;
             int centerBlockX = ((bounds.chunkMinX + bounds.chunkMaxX) / 2) * 16 + 8;
             int centerBlockZ = ((bounds.chunkMinZ + bounds.chunkMaxZ) / 2) * 16 + 8;
             
@@ -183,6 +232,9 @@ void BedWarsServer::on_init(engine::IEngineServices& engine) {
         }
     }
     
+    // Seed and map are the world inputs a replay needs besides the messages
+    engine_->set_session_info(worldSeed_, mapId_, mapVersion_);
+    
     // Calculate spawn height (find ground level at map center)
     float spawnY = 80.0f;  // Default spawn height
     if (hasMapTemplate_) {
@@ -358,7 +410,10 @@ void BedWarsServer::on_shutdown() {
     engine_->log_info("BedWars server shutting down");
     scriptEngine_.reset();
     players_.clear();
+    simOrder_.clear();
+    simPool_.reset();
     terrain_.reset();
+    profiler_ = nullptr;
     engine_ = nullptr;
 }
 
@@ -367,55 +422,129 @@ void BedWarsServer::on_shutdown() {
 // ============================================================================
 
 void BedWarsServer::on_tick(float dt) {
+    using engine::ScopedPhaseTimer;
+    
     // Update match phase
-    update_match_phase(dt);
+    {
+        ScopedPhaseTimer timer(profiler_, phases_.matchPhase);
+        update_match_phase(dt);
+    }
     
     // Update generators and items
-    update_generators(dt);
-    update_items(dt);
+    {
+        ScopedPhaseTimer timer(profiler_, phases_.generators);
+        update_generators(dt);
+    }
+    {
+        ScopedPhaseTimer timer(profiler_, phases_.items);
+        update_items(dt);
+    }
     
     // Update combat systems
     if (matchPhase_ == MatchPhase::InProgress) {
+        ScopedPhaseTimer timer(profiler_, phases_.combat);
         update_regeneration(dt);
         update_respawns(dt);
     }
     
+    {
+        ScopedPhaseTimer timer(profiler_, phases_.simulatePlayers);
+        simulate_players(dt);
+    }
+    
+    {
+        ScopedPhaseTimer timer(profiler_, phases_.worldSync);
+        update_world_sync();
+    }
+    
+    {
+        ScopedPhaseTimer timer(profiler_, phases_.snapshots);
+        for (const auto& [id, player] : players_) {
+            if (!player.joined) continue;
+            
+            // Send state snapshot
+            proto::StateSnapshot snapshot;
+            snapshot.serverTick = engine_->current_tick();
+            snapshot.playerId = id;
+            snapshot.px = player.px;
+            snapshot.py = player.py;
+            snapshot.pz = player.pz;
+            snapshot.vx = player.vx;
+            snapshot.vy = player.vy;
+            snapshot.vz = player.vz;
+            snapshot.lastInputSeq = player.inputs.last_processed_seq();
+            snapshot.flags = static_cast<std::uint8_t>(
+                (player.onGround ? proto::StateSnapshot::kFlagOnGround : 0) |
+                (player.lastJumpHeld ? proto::StateSnapshot::kFlagJumpHeld : 0));
+            
+            // Superseded next tick: never worth a retransmission
+            send_message(id, snapshot, engine::Delivery::UnreliableSequenced);
+        }
+        
+        send_entity_snapshots();
+    }
+}
+
+// ============================================================================
+// Physics simulation (simplified from legacy server)
+// ============================================================================
+
+void BedWarsServer::simulate_players(float dt) {
+    // Fixed order by id, so claims resolve the same way for any lane count
+    simOrder_.clear();
     for (auto& [id, player] : players_) {
-        if (!player.joined) continue;
+        if (player.joined) simOrder_.emplace_back(id, &player);
+    }
+    std::sort(simOrder_.begin(), simOrder_.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+    
+    for (auto& claims : laneClaims_) {
+        claims.clear();
+    }
+    const engine::Tick tick = engine_->current_tick();
+    
+    // A job only writes its own PlayerState and reads terrain_ and the item
+    // pool; anything shared waits in the lane's claim list.
+    simPool_->parallel_for(simOrder_.size(), [&](std::size_t i, std::size_t lane) {
+        PlayerState& player = *simOrder_[i].second;
         
         // Use editor camera mode or normal physics
         if (opts_.editorCameraMode) {
             simulate_editor_camera(player, dt);
         } else if (player.alive) {
             simulate_player(player, dt);
-            
-            // Check for item pickup
-            process_item_pickup(id);
+            player.history.record(tick, player.px, player.py, player.pz);
+            if (player.attackCooldown > 0.0f) {
+                player.attackCooldown -= dt;
+            }
+            collect_item_pickups(static_cast<std::uint32_t>(i), player, laneClaims_[lane]);
+        } else {
+            // Dead: still consume inputs so the acked seq keeps moving
+            player.inputs.take_latest();
         }
-        
-        // Send state snapshot
-        proto::StateSnapshot snapshot;
-        snapshot.serverTick = engine_->current_tick();
-        snapshot.playerId = id;
-        snapshot.px = player.px;
-        snapshot.py = player.py;
-        snapshot.pz = player.pz;
-        snapshot.vx = player.vx;
-        snapshot.vy = player.vy;
-        snapshot.vz = player.vz;
-        
-        send_message(id, snapshot);
+    });
+    
+    // Serial side effects in player order; a player's claims all come from one
+    // lane, already in query order.
+    pickupClaims_.clear();
+    for (const auto& claims : laneClaims_) {
+        pickupClaims_.insert(pickupClaims_.end(), claims.begin(), claims.end());
+    }
+    std::stable_sort(pickupClaims_.begin(), pickupClaims_.end(),
+                     [](const PickupClaim& a, const PickupClaim& b) { return a.order < b.order; });
+    
+    for (const auto& claim : pickupClaims_) {
+        auto& [id, player] = simOrder_[claim.order];
+        apply_item_pickup(id, *player, claim.itemId);
     }
 }
 
-// ============================================================================
-// Physics simulation (simplified from legacy server)
-// ============================================================================
-
 void BedWarsServer::simulate_editor_camera(PlayerState& player, float dt) {
     using namespace physics;
     
-    const auto& input = player.lastInput;
+    // Free-fly is not replayed per input: one step per tick with the newest state
+    player.inputs.take_latest();
+    const auto& input = player.inputs.last();
     const float speed = input.sprint ? kEditorFlySpeed * 2.0f : kEditorFlySpeed;
     
     // Calculate movement direction from yaw
@@ -443,20 +572,23 @@ void BedWarsServer::simulate_editor_camera(PlayerState& player, float dt) {
 }
 
 void BedWarsServer::simulate_player(PlayerState& player, float dt) {
+    game::InputBuffer::Batch batch;
+    const std::uint32_t count = player.inputs.take_for_tick(batch);
     if (!terrain_) return;
     
-    const auto& input = player.lastInput;
-    
-    // Use full physics simulation with step-up and proper collision
-    physics::simulate_physics_step(
-        *terrain_,
-        player.px, player.py, player.pz,
-        player.vx, player.vy, player.vz,
-        player.onGround, player.lastJumpHeld,
-        input.moveX, input.moveY, input.yaw,
-        input.jump, input.sprint,
-        dt
-    );
+    // One physics step per client input (the client stepped each one with the same dt)
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const auto& input = batch[i];
+        physics::simulate_physics_step(
+            *terrain_,
+            player.px, player.py, player.pz,
+            player.vx, player.vy, player.vz,
+            player.onGround, player.lastJumpHeld,
+            input.moveX, input.moveY, input.yaw,
+            input.jump, input.sprint,
+            dt
+        );
+    }
 }
 
 bool BedWarsServer::check_collision_at(float px, float py, float pz) const {
@@ -536,6 +668,9 @@ void BedWarsServer::on_player_message(engine::PlayerId id, std::span<const std::
         else if constexpr (std::is_same_v<T, proto::SelectTeam>) {
             handle_select_team(id, m);
         }
+        else if constexpr (std::is_same_v<T, proto::TryAttack>) {
+            handle_try_attack(id, m);
+        }
     }, *msg);
 }
 
@@ -568,7 +703,7 @@ void BedWarsServer::handle_client_hello(engine::PlayerId id, const proto::Client
     send_message(id, hello);
 }
 
-void BedWarsServer::handle_join_match(engine::PlayerId id, const proto::JoinMatch& /*msg*/) {
+void BedWarsServer::handle_join_match(engine::PlayerId id, const proto::JoinMatch& msg) {
     engine_->log_info("Player " + std::to_string(id) + " joining match");
     
     auto it = players_.find(id);
@@ -576,6 +711,8 @@ void BedWarsServer::handle_join_match(engine::PlayerId id, const proto::JoinMatc
     
     it->second.joined = true;
     it->second.alive = true;
+    it->second.hasMapTemplate = hasMapTemplate_ && msg.hasMapTemplate;
+    it->second.inputs.clear();  // A rejoining client starts its seq over
     
     // BW-1: Don't auto-assign team — player must select via SelectTeam message.
     // Place them in lobby spawn while waiting for team selection.
@@ -596,29 +733,8 @@ void BedWarsServer::handle_join_match(engine::PlayerId id, const proto::JoinMatc
     ack.playerId = id;
     send_message(id, ack);
     
-    // Send all modified blocks to the new player (delta from map template)
-    if (!modifiedBlocks_.empty()) {
-        engine_->log_info("Sending " + std::to_string(modifiedBlocks_.size()) + " modified blocks to player " + std::to_string(id));
-        for (const auto& mb : modifiedBlocks_) {
-            if (mb.type == shared::voxel::BlockType::Air) {
-                // Send as BlockBroken
-                proto::BlockBroken broken;
-                broken.x = mb.x;
-                broken.y = mb.y;
-                broken.z = mb.z;
-                send_message(id, broken);
-            } else {
-                // Send as BlockPlaced
-                proto::BlockPlaced placed;
-                placed.x = mb.x;
-                placed.y = mb.y;
-                placed.z = mb.z;
-                placed.blockType = mb.type;
-                placed.stateByte = mb.state;
-                send_message(id, placed);
-            }
-        }
-    }
+    // Stream world modifications over the next ticks (WorldDelta batches)
+    begin_world_sync(id, it->second);
     
     // Send health
     proto::HealthUpdate health;
@@ -678,6 +794,7 @@ void BedWarsServer::handle_select_team(engine::PlayerId id, const proto::SelectT
     it->second.px = team.spawnX;
     it->second.py = team.spawnY;
     it->second.pz = team.spawnZ;
+    it->second.history.clear();
 
     // Broadcast team assignment to all players
     proto::TeamAssigned teamMsg;
@@ -692,7 +809,18 @@ void BedWarsServer::handle_input_frame(engine::PlayerId id, const proto::InputFr
     auto it = players_.find(id);
     if (it == players_.end() || !it->second.joined) return;
     
-    it->second.lastInput = msg;
+    auto& player = it->second;
+    player.inputs.push(msg);
+    
+    // A newly acked snapshot times the round trip (send -> client apply -> ack here).
+    // Acks from the future are bogus: they would become the delta baseline and
+    // block every real ack until the server tick caught up.
+    const engine::Tick now = engine_->current_tick();
+    if (msg.ackSnapshotTick > player.ackedSnapshotTick && msg.ackSnapshotTick <= now) {
+        const auto sample = static_cast<float>(now - msg.ackSnapshotTick);
+        player.rttTicks = player.rttTicks == 0.0f ? sample : player.rttTicks + (sample - player.rttTicks) * 0.125f;
+        player.ackedSnapshotTick = msg.ackSnapshotTick;
+    }
 }
 
 void BedWarsServer::handle_try_place_block(engine::PlayerId id, const proto::TryPlaceBlock& msg) {
@@ -792,9 +920,6 @@ void BedWarsServer::handle_try_place_block(engine::PlayerId id, const proto::Try
     }
     terrain_->set_block_state(msg.x, msg.y, msg.z, state);
 
-    // Track modified block for late joiners
-    modifiedBlocks_.push_back({msg.x, msg.y, msg.z, finalBlockType, state.to_byte()});
-
     // Broadcast placement
     proto::BlockPlaced placed;
     placed.x = msg.x;
@@ -887,9 +1012,6 @@ void BedWarsServer::handle_try_break_block(engine::PlayerId id, const proto::Try
     terrain_->break_player_block(msg.x, msg.y, msg.z);
     terrain_->set_block_state(msg.x, msg.y, msg.z, BlockRuntimeState::defaults());
 
-    // Track modified block for late joiners (Air block)
-    modifiedBlocks_.push_back({msg.x, msg.y, msg.z, BlockType::Air, 0});
-
     // Broadcast break event
     proto::BlockBroken broken;
     broken.x = msg.x;
@@ -1196,46 +1318,243 @@ void BedWarsServer::broadcast_neighbor_updates(int x, int y, int z) {
     }
 }
 
-void BedWarsServer::send_chunk_data(engine::PlayerId id, int chunkX, int chunkZ) {
-    if (!terrain_) return;
+std::size_t BedWarsServer::send_chunk_data(engine::PlayerId id, int chunkX, int chunkZ) {
+    if (!terrain_) return 0;
     
     proto::ChunkData chunk;
     chunk.chunkX = chunkX;
     chunk.chunkZ = chunkZ;
     
-    // Reserve space for 16x256x16 blocks
-    constexpr int kChunkSize = 16;
-    constexpr int kWorldHeight = 256;
-    chunk.blocks.resize(kChunkSize * kWorldHeight * kChunkSize);
+    // Bulk copy: template memcpy / procedural column fill, then overrides
+    chunk.blocks = terrain_->get_chunk_data(chunkX, chunkZ);
+    
+    // Clients holding the template only need the cells that differ from it
+    auto it = players_.find(id);
+    if (it != players_.end() && it->second.hasMapTemplate) {
+        const auto* tmpl = terrain_->map_template();
+        const auto* base = tmpl ? tmpl->find_chunk(chunkX, chunkZ) : nullptr;
+        std::span<const std::uint8_t> baseBlocks;
+        if (base) {
+            baseBlocks = {reinterpret_cast<const std::uint8_t*>(base->blocks.data()), base->blocks.size()};
+        }
+        proto::chunk_codec::make_delta(chunk.blocks, baseBlocks);
+        chunk.deltaFromTemplate = true;
+    }
+    
+    engine::PacketRef packet = proto::serialize_packet(chunk);
+    const std::size_t bytes = packet.data().size();
+    engine_->send_packet(id, std::move(packet), engine::Delivery::ReliableOrdered);
+    return bytes;
+}
+
+// ============================================================================
+// Late-join world sync
+// ============================================================================
+
+void BedWarsServer::begin_world_sync(engine::PlayerId id, PlayerState& player) {
+    player.syncChunks = terrain_ ? terrain_->get_modified_chunks() : std::vector<std::pair<int, int>>{};
+    player.syncCursor = 0;
+    player.syncPending = true;
+    
+    // A client without our template can't rebuild the map from edits alone:
+    // send it every template column (plus edited ones outside it) whole
+    const auto* tmpl = terrain_ ? terrain_->map_template() : nullptr;
+    player.syncWholeChunks = tmpl && !player.hasMapTemplate;
+    if (player.syncWholeChunks) {
+        for (const auto& [key, chunk] : tmpl->chunks) {
+            (void)chunk;
+            player.syncChunks.push_back(key);
+        }
+        std::sort(player.syncChunks.begin(), player.syncChunks.end());
+        player.syncChunks.erase(std::unique(player.syncChunks.begin(), player.syncChunks.end()),
+                                player.syncChunks.end());
+    }
+    
+    engine_->log_info("World sync for player " + std::to_string(id) + ": " +
+                      std::to_string(player.syncChunks.size()) +
+                      (player.syncWholeChunks ? " whole chunks" : " modified chunks"));
+}
+
+void BedWarsServer::update_world_sync() {
+    // Wire cost estimate: index varint + type + state per block, coords + count per chunk
+    constexpr std::size_t kBytesPerBlock = 4;
+    constexpr std::size_t kBytesPerChunk = 12;
+    
+    std::size_t syncing = 0;
+    for (const auto& [id, player] : players_) {
+        if (player.syncPending) ++syncing;
+    }
     
-    int baseX = chunkX * kChunkSize;
-    int baseZ = chunkZ * kChunkSize;
+    std::size_t remaining = matchConfig_.worldSyncBytesPerTick;
     
-    for (int y = 0; y < kWorldHeight; ++y) {
-        for (int z = 0; z < kChunkSize; ++z) {
-            for (int x = 0; x < kChunkSize; ++x) {
-                int idx = y * kChunkSize * kChunkSize + z * kChunkSize + x;
-                auto block = terrain_->get_block(baseX + x, y, baseZ + z);
-                chunk.blocks[idx] = static_cast<std::uint8_t>(block);
+    for (auto& [id, player] : players_) {
+        if (!player.syncPending) continue;
+        
+        // Equal share of what is left, so one big sync never starves the other
+        // late joiners; whatever a player doesn't use goes to the ones after it
+        const std::size_t share = std::max<std::size_t>(remaining / syncing--, 1);
+        std::size_t budget = share;
+        
+        proto::WorldDelta delta;
+        std::size_t packetBytes = 0;
+        bool sentFinal = false;
+        
+        auto flush = [&](bool final) {
+            delta.final = final;
+            sentFinal = final;
+            send_message(id, delta);
+            budget = packetBytes >= budget ? 0 : budget - packetBytes;
+            delta.chunks.clear();
+            packetBytes = 0;
+        };
+        
+        while (player.syncCursor < player.syncChunks.size() && packetBytes < budget) {
+            const auto [cx, cz] = player.syncChunks[player.syncCursor++];
+            
+            // Read current state at send time: edits made since the join were
+            // already broadcast, and this is never older than those.
+            if (player.syncWholeChunks) {
+                const std::size_t sent = send_chunk_data(id, cx, cz);
+                budget = sent >= budget ? 0 : budget - sent;
+                continue;
+            }
+            const auto mods = terrain_->get_chunk_modifications(cx, cz);
+            if (mods.empty()) continue;
+            
+            // Heavily edited columns are smaller as palette sections of
+            // template deltas than as one entry per block
+            if (player.hasMapTemplate && mods.size() > matchConfig_.worldSyncChunkDataBlocks) {
+                const std::size_t sent = send_chunk_data(id, cx, cz);
+                budget = sent >= budget ? 0 : budget - sent;
+                continue;
+            }
+            
+            proto::WorldDelta::Chunk chunk;
+            chunk.chunkX = cx;
+            chunk.chunkZ = cz;
+            chunk.blocks.reserve(mods.size());
+            for (const auto& m : mods) {
+                const int lx = m.x - cx * shared::voxel::CHUNK_WIDTH;
+                const int lz = m.z - cz * shared::voxel::CHUNK_DEPTH;
+                chunk.blocks.push_back({static_cast<std::uint16_t>(m.y * 256 + lz * 16 + lx), m.type, m.state.to_byte()});
+            }
+            // Modifications come bottom-up per section, which is already ascending index order
+            
+            delta.chunks.push_back(std::move(chunk));
+            packetBytes += kBytesPerChunk + mods.size() * kBytesPerBlock;
+            
+            if (packetBytes >= matchConfig_.worldSyncPacketBytes) {
+                flush(player.syncCursor >= player.syncChunks.size());
             }
         }
+        
+        const bool done = player.syncCursor >= player.syncChunks.size();
+        if (!delta.chunks.empty()) {
+            flush(done);
+        } else if (done && !sentFinal) {
+            flush(true);  // Empty end marker
+        }
+        
+        if (done) {
+            player.syncPending = false;
+            player.syncChunks.clear();
+            player.syncChunks.shrink_to_fit();
+        }
+        
+        const std::size_t used = share - budget;
+        remaining = used >= remaining ? 0 : remaining - used;
     }
+}
+
+// ============================================================================
+// Entity replication
+// ============================================================================
+
+void BedWarsServer::send_entity_snapshots() {
+    namespace sc = proto::snapshot_codec;
     
-    send_message(id, chunk);
+    // Quantized position 1024 units = 16 blocks = one chunk
+    constexpr int kChunkShift = 10;
+    
+    const engine::Tick tick = engine_->current_tick();
+    
+    // Quantize every joined player once; each viewer picks from this list
+    snapshotEntities_.clear();
+    for (const auto& [id, player] : players_) {
+        if (!player.joined) continue;
+        sc::EntityState s;
+        s.id = id;
+        s.x = sc::quantize_position(player.px);
+        s.y = sc::quantize_position(player.py);
+        s.z = sc::quantize_position(player.pz);
+        s.yaw = sc::quantize_yaw(player.inputs.last().yaw);
+        s.pitch = sc::quantize_pitch(player.inputs.last().pitch);
+        s.team = player.team;
+        s.flags = static_cast<std::uint8_t>((player.alive ? proto::EntitySnapshot::kFlagAlive : 0) |
+                                            (player.onGround ? proto::EntitySnapshot::kFlagOnGround : 0));
+        snapshotEntities_.push_back(s);
+    }
+    std::sort(snapshotEntities_.begin(), snapshotEntities_.end(),
+              [](const sc::EntityState& a, const sc::EntityState& b) { return a.id < b.id; });
+    
+    const auto contains = [](const sc::EntityList& list, engine::PlayerId id) {
+        return std::binary_search(list.begin(), list.end(), sc::EntityState{id},
+                                  [](const sc::EntityState& a, const sc::EntityState& b) { return a.id < b.id; });
+    };
+    
+    proto::EntitySnapshot msg;
+    msg.serverTick = tick;
+    
+    for (auto& [viewerId, viewer] : players_) {
+        if (!viewer.joined) continue;
+        
+        // Delta against the newest snapshot the client decoded, while we still hold it.
+        // Both are older than tick, so store(tick) below never reuses their slots.
+        const sc::EntityList* baseline = nullptr;
+        if (viewer.ackedSnapshotTick != 0 && tick - viewer.ackedSnapshotTick < sc::History::kSize) {
+            baseline = viewer.sentSnapshots.find(viewer.ackedSnapshotTick);
+        }
+        const sc::EntityList* previous = nullptr;
+        if (tick - viewer.lastSnapshotTick < sc::History::kSize) {
+            previous = viewer.sentSnapshots.find(viewer.lastSnapshotTick);
+        }
+        
+        const int viewerCx = sc::quantize_position(viewer.px) >> kChunkShift;
+        const int viewerCz = sc::quantize_position(viewer.pz) >> kChunkShift;
+        
+        // Interest: players in chunks the client has loaded. Once visible, an
+        // entity stays until it is one chunk further out, so edges don't flicker.
+        auto& visible = viewer.sentSnapshots.store(tick);
+        for (const auto& e : snapshotEntities_) {
+            if (e.id == viewerId) continue;
+            const int radius = matchConfig_.snapshotInterestChunks +
+                               ((previous && contains(*previous, e.id)) ? 1 : 0);
+            if (std::abs((e.x >> kChunkShift) - viewerCx) > radius ||
+                std::abs((e.z >> kChunkShift) - viewerCz) > radius) {
+                continue;
+            }
+            visible.push_back(e);
+        }
+        viewer.lastSnapshotTick = tick;
+        
+        msg.baselineTick = baseline ? viewer.ackedSnapshotTick : 0;
+        sc::build_delta(visible, baseline, msg);
+        
+        // Sent even when empty (a dozen bytes) so the client keeps acking a fresh baseline
+        send_message(viewerId, msg, engine::Delivery::UnreliableSequenced);
+    }
 }
 
 // ============================================================================
 // Helpers
 // ============================================================================
 
-void BedWarsServer::send_message(engine::PlayerId id, const proto::Message& msg) {
-    auto data = proto::serialize(msg);
-    engine_->send(id, data);
+void BedWarsServer::send_message(engine::PlayerId id, const proto::Message& msg, engine::Delivery delivery) {
+    engine_->send_packet(id, proto::serialize_packet(msg), delivery);
 }
 
 void BedWarsServer::broadcast_message(const proto::Message& msg) {
-    auto data = proto::serialize(msg);
-    engine_->broadcast(data);
+    engine_->broadcast_packet(proto::serialize_packet(msg));
 }
 
 // ============================================================================
@@ -1329,6 +1648,7 @@ void BedWarsServer::start_match() {
             player.py = team.spawnY;
             player.pz = team.spawnZ;
             player.vx = player.vy = player.vz = 0.0f;
+            player.history.clear();
             player.alive = true;
             player.hp = player.maxHp;
         }
@@ -1407,6 +1727,69 @@ proto::TeamId BedWarsServer::assign_team(engine::PlayerId playerId) {
 // Combat
 // ============================================================================
 
+double BedWarsServer::estimate_view_tick(const PlayerState& attacker, engine::Tick claimed) const {
+    // The client sees others viewLagTicks behind the newest snapshot it applied.
+    // Trust its claim only near what its measured round trip allows, so a
+    // client cannot reach further into the past by lying.
+    const double now = static_cast<double>(engine_->current_tick());
+    const double lag = static_cast<double>(matchConfig_.viewLagTicks);
+    const double expected = now - static_cast<double>(attacker.rttTicks) - lag;
+    
+    double view = static_cast<double>(claimed) - lag;
+    if (claimed == 0 || std::abs(view - expected) > static_cast<double>(matchConfig_.viewTickTolerance)) {
+        view = expected;
+    }
+    return std::clamp(view, now - static_cast<double>(matchConfig_.maxRewindTicks), now);
+}
+
+void BedWarsServer::handle_try_attack(engine::PlayerId id, const proto::TryAttack& msg) {
+    const auto reject = [&](proto::RejectReason reason) {
+        proto::ActionRejected rejected;
+        rejected.seq = msg.seq;
+        rejected.reason = reason;
+        send_message(id, rejected);
+    };
+    
+    auto attackerIt = players_.find(id);
+    auto targetIt = players_.find(msg.targetId);
+    if (matchPhase_ != MatchPhase::InProgress || msg.targetId == id ||
+        attackerIt == players_.end() || targetIt == players_.end() ||
+        !attackerIt->second.joined || !attackerIt->second.alive ||
+        !targetIt->second.joined || !targetIt->second.alive) {
+        reject(proto::RejectReason::NotAllowed);
+        return;
+    }
+    
+    auto& attacker = attackerIt->second;
+    const auto& target = targetIt->second;
+    if (attacker.attackCooldown > 0.0f) {
+        reject(proto::RejectReason::NotAllowed);
+        return;
+    }
+    
+    // Target where the attacker saw it; the attacker itself swings from now
+    float tx = target.px;
+    float ty = target.py;
+    float tz = target.pz;
+    target.history.sample(estimate_view_tick(attacker, msg.viewTick), tx, ty, tz);
+    
+    const float yawRad = msg.yaw * physics::kDegToRad;
+    const float pitchRad = msg.pitch * physics::kDegToRad;
+    const float dx = std::cos(pitchRad) * std::sin(yawRad);
+    const float dy = std::sin(pitchRad);
+    const float dz = std::cos(pitchRad) * std::cos(yawRad);
+    
+    const float dist = ray_player_box_distance(attacker.px, attacker.py + bedwars::kPlayerEyeHeight, attacker.pz,
+                                               dx, dy, dz, tx, ty, tz, matchConfig_.hitboxPadding);
+    if (dist < 0.0f || dist > matchConfig_.meleeReach) {
+        reject(proto::RejectReason::OutOfRange);
+        return;
+    }
+    
+    attacker.attackCooldown = matchConfig_.attackCooldown;
+    process_damage(msg.targetId, matchConfig_.baseMeleeDamage, id);
+}
+
 void BedWarsServer::process_damage(engine::PlayerId targetId, std::uint8_t damage, engine::PlayerId attackerId) {
     auto it = players_.find(targetId);
     if (it == players_.end() || !it->second.alive) return;
@@ -1500,6 +1883,7 @@ void BedWarsServer::process_respawn(engine::PlayerId playerId) {
     }
     
     player.vx = player.vy = player.vz = 0.0f;
+    player.history.clear();
     player.alive = true;
     player.hp = player.maxHp;
     player.respawnTimer = 0.0f;
@@ -1564,26 +1948,50 @@ void BedWarsServer::update_generators(float dt) {
 }
 
 void BedWarsServer::spawn_item(const GeneratorState& gen) {
+    // Item type based on generator tier
+    proto::ItemType itemType;
+    switch (gen.tier) {
+        case 0: itemType = proto::ItemType::Iron; break;
+        case 1: itemType = proto::ItemType::Gold; break;
+        case 2: itemType = proto::ItemType::Diamond; break;
+        case 3: itemType = proto::ItemType::Emerald; break;
+        default: itemType = proto::ItemType::Iron; break;
+    }
+    
+    // Merge into a stack lying at the generator; only the new count goes out
+    DroppedItemState* stack = nullptr;
+    itemGrid_.query_radius(gen.x, gen.y, gen.z, matchConfig_.itemMergeRadius,
+                           [&](engine::SpatialGrid::Id id, float, float, float) {
+        if (stack) return;
+        auto* item = droppedItems_.get(id);
+        if (item && item->itemType == itemType && item->count < matchConfig_.itemMaxStack) {
+            stack = item;
+        }
+    });
+    if (stack) {
+        ++stack->count;
+        stack->lifetime = 0.0f;  // Despawn timer follows the newest drop
+        
+        proto::ItemCountChanged changed;
+        changed.entityId = stack->entityId;
+        changed.count = stack->count;
+        broadcast_message(changed);
+        return;
+    }
+    
     DroppedItemState item;
-    item.entityId = next_entity_id();
+    item.itemType = itemType;
     item.x = gen.x;
     item.y = gen.y;
     item.z = gen.z;
     item.count = 1;
     item.lifetime = 0.0f;
     item.pickupDelay = 0.0f;
-    item.active = true;
-    
-    // Item type based on generator tier
-    switch (gen.tier) {
-        case 0: item.itemType = proto::ItemType::Iron; break;
-        case 1: item.itemType = proto::ItemType::Gold; break;
-        case 2: item.itemType = proto::ItemType::Diamond; break;
-        case 3: item.itemType = proto::ItemType::Emerald; break;
-        default: item.itemType = proto::ItemType::Iron; break;
-    }
     
-    droppedItems_.push_back(item);
+    item.entityId = droppedItems_.create(item);
+    if (item.entityId == decltype(droppedItems_)::kInvalidId) return;
+    droppedItems_.get(item.entityId)->entityId = item.entityId;
+    itemGrid_.insert(item.entityId, item.x, item.y, item.z);
     
     // Broadcast spawn
     proto::ItemSpawned spawned;
@@ -1597,9 +2005,7 @@ void BedWarsServer::spawn_item(const GeneratorState& gen) {
 }
 
 void BedWarsServer::update_items(float dt) {
-    for (auto& item : droppedItems_) {
-        if (!item.active) continue;
-        
+    droppedItems_.for_each([&](std::uint32_t id, DroppedItemState& item) {
         item.lifetime += dt;
         if (item.pickupDelay > 0.0f) {
             item.pickupDelay -= dt;
@@ -1607,52 +2013,48 @@ void BedWarsServer::update_items(float dt) {
         
         // Despawn after 5 minutes
         if (item.lifetime > 300.0f) {
-            item.active = false;
+            itemGrid_.remove(id);
+            droppedItems_.destroy(id);
         }
-    }
-    
-    // Remove inactive items
-    droppedItems_.erase(
-        std::remove_if(droppedItems_.begin(), droppedItems_.end(),
-                       [](const DroppedItemState& i) { return !i.active; }),
-        droppedItems_.end()
-    );
+    });
 }
 
-void BedWarsServer::process_item_pickup(engine::PlayerId playerId) {
-    auto playerIt = players_.find(playerId);
-    if (playerIt == players_.end() || !playerIt->second.alive) return;
-    
-    auto& player = playerIt->second;
-    
-    for (auto& item : droppedItems_) {
-        if (!item.active || item.pickupDelay > 0.0f) continue;
-        
-        // Check distance
-        float dx = item.x - player.px;
-        float dy = item.y - player.py;
-        float dz = item.z - player.pz;
-        float distSq = dx*dx + dy*dy + dz*dz;
-        
-        if (distSq <= matchConfig_.itemPickupRadius * matchConfig_.itemPickupRadius) {
-            // Add to inventory
-            player.inventory[item.itemType] += item.count;
-            item.active = false;
-            
-            // Broadcast pickup
-            proto::ItemPickedUp pickup;
-            pickup.entityId = item.entityId;
-            pickup.playerId = playerId;
-            broadcast_message(pickup);
-            
-            // Send inventory update
-            proto::InventoryUpdate inv;
-            inv.playerId = playerId;
-            inv.itemType = item.itemType;
-            inv.count = player.inventory[item.itemType];
-            send_message(playerId, inv);
+void BedWarsServer::collect_item_pickups(std::uint32_t order, const PlayerState& player,
+                                         std::vector<PickupClaim>& out) const {
+    // Only items in the cells around the player
+    itemGrid_.query_radius(player.px, player.py, player.pz, matchConfig_.itemPickupRadius,
+                           [&](engine::SpatialGrid::Id id, float, float, float) {
+        const auto* item = droppedItems_.get(id);
+        if (item && item->pickupDelay <= 0.0f) {
+            out.push_back(PickupClaim{order, id});
         }
-    }
+    });
+}
+
+void BedWarsServer::apply_item_pickup(engine::PlayerId playerId, PlayerState& player, std::uint32_t itemId) {
+    // A player earlier in the order may have taken it already
+    const auto* found = droppedItems_.get(itemId);
+    if (!found) return;
+    
+    const auto item = *found;
+    droppedItems_.destroy(itemId);
+    itemGrid_.remove(itemId);
+    
+    // Add to inventory
+    player.inventory[item.itemType] += item.count;
+    
+    // Broadcast pickup
+    proto::ItemPickedUp pickup;
+    pickup.entityId = item.entityId;
+    pickup.playerId = playerId;
+    broadcast_message(pickup);
+    
+    // Send inventory update
+    proto::InventoryUpdate inv;
+    inv.playerId = playerId;
+    inv.itemType = item.itemType;
+    inv.count = player.inventory[item.itemType];
+    send_message(playerId, inv);
 }
 
 std::uint32_t BedWarsServer::next_entity_id() {
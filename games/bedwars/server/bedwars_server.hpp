@@ -1,8 +1,15 @@
 #pragma once
 
 #include <engine/core/game_interface.hpp>
+#include <engine/core/tick_profiler.hpp>
+#include <engine/core/spatial_grid.hpp>
+#include <engine/core/thread_pool.hpp>
 #include "../shared/protocol/messages.hpp"
-#include "physics_utils.hpp"
+#include "../shared/protocol/snapshot_codec.hpp"
+#include "game/input_buffer.hpp"
+#include "game/position_history.hpp"
+#include "game/stable_pool.hpp"
+#include "../shared/physics/physics_utils.hpp"
 #include "scripting/bedwars_script_engine.hpp"
 
 // Use shared voxel types from engine
@@ -51,10 +58,27 @@ struct MatchConfig {
     float attackCooldown{0.5f};
     float regenDelay{4.0f};
     std::uint8_t baseMeleeDamage{4};  // Half hearts
+    float meleeReach{3.5f};           // Eye to rewound hitbox (client swings at 3)
+    float hitboxPadding{0.1f};        // Added around the player box for hit tests
+    
+    // Lag compensation: targets are rewound to the attacker's view time
+    engine::Tick maxRewindTicks{10};  // ~330 ms at 30 TPS; older claims are clamped
+    float viewLagTicks{2.0f};         // Client draws others this far behind its newest snapshot
+    float viewTickTolerance{3.0f};    // Claimed view tick may stray this far from the RTT estimate
     
     // Gameplay
     float itemPickupRadius{1.5f};
+    float itemMergeRadius{1.0f};       // Generator drops join a same-type stack this close
+    std::uint16_t itemMaxStack{64};    // Beyond this a new stack is started
     bool friendlyFire{false};
+    
+    // Late-join world sync (WorldDelta, ChunkData for whole columns)
+    std::size_t worldSyncPacketBytes{8 * 1024};    // Target size of one WorldDelta packet
+    std::size_t worldSyncBytesPerTick{32 * 1024};  // Per tick, shared equally by all syncing players
+    std::size_t worldSyncChunkDataBlocks{256};     // Columns with more edits go as template-delta ChunkData
+    
+    // Entity replication (EntitySnapshot)
+    int snapshotInterestChunks{8};  // Chunk radius of replicated players (client render distance)
 };
 
 // ============================================================================
@@ -114,9 +138,11 @@ struct DroppedItemState {
     std::uint16_t count{1};
     float lifetime{0.0f};
     float pickupDelay{0.0f};
-    bool active{true};
 };
 
+// Grid cell edge in blocks; a pickup query touches at most 2x2 cells.
+inline constexpr float kItemGridCellSize = 4.0f;
+
 // ============================================================================
 // BedWarsServer - Implements engine::IGameServer
 // ============================================================================
@@ -128,6 +154,7 @@ public:
         std::string name;
         bool joined{false};
         bool handshakeComplete{false};
+        bool hasMapTemplate{false};  // Client holds our template: chunks go as deltas
         
         // Position (authoritative)
         float px{50.0f};
@@ -143,8 +170,8 @@ public:
         bool onGround{false};
         bool lastJumpHeld{false};
         
-        // Input
-        proto::InputFrame lastInput{};
+        // Input: queued by seq, each simulated once
+        game::InputBuffer inputs;
         
         // Combat
         std::uint8_t hp{20};
@@ -152,6 +179,11 @@ public:
         float lastDamageTaken{0.0f};  // Time since last damage (for regen)
         float attackCooldown{0.0f};
         
+        // Lag compensation: where this player was on recent ticks, and the
+        // smoothed snapshot-to-ack round trip of its client
+        game::PositionHistory history;
+        float rttTicks{0.0f};
+        
         // Respawn
         bool alive{true};
         float respawnTimer{0.0f};
@@ -163,6 +195,17 @@ public:
         
         // Simple inventory: count per item type
         std::unordered_map<proto::ItemType, std::uint16_t> inventory;
+        
+        // Late-join world sync: chunk columns still to be streamed
+        std::vector<std::pair<int, int>> syncChunks;
+        std::size_t syncCursor{0};
+        bool syncPending{false};
+        bool syncWholeChunks{false};  // Client lacks our template: every column goes as ChunkData
+        
+        // Entity replication: what we sent per tick, and the newest tick the client decoded
+        proto::snapshot_codec::History sentSnapshots;
+        engine::Tick lastSnapshotTick{0};
+        engine::Tick ackedSnapshotTick{0};
     };
     
     struct Options {
@@ -170,6 +213,7 @@ public:
         bool loadMapTemplate{true};     // Load .rfmap on startup
         bool autoStartMatch{true};      // Auto-start when min players reached
         std::string mapName;            // Map file to load (empty = most recent)
+        std::size_t simulationWorkers{0};  // Extra threads for player movement (0 = tick thread only)
     };
     
     explicit BedWarsServer(std::uint32_t seed = 12345);
@@ -195,6 +239,7 @@ private:
     void handle_try_break_block(engine::PlayerId id, const proto::TryBreakBlock& msg);
     void handle_try_set_block(engine::PlayerId id, const proto::TrySetBlock& msg);
     void handle_try_export_map(engine::PlayerId id, const proto::TryExportMap& msg);
+    void handle_try_attack(engine::PlayerId id, const proto::TryAttack& msg);
     
     // --- Match flow ---
     void update_match_phase(float dt);
@@ -207,6 +252,7 @@ private:
     void process_damage(engine::PlayerId target, std::uint8_t damage, engine::PlayerId attacker);
     void process_death(engine::PlayerId playerId, engine::PlayerId killerId);
     void process_respawn(engine::PlayerId playerId);
+    double estimate_view_tick(const PlayerState& attacker, engine::Tick claimed) const;
     void update_regeneration(float dt);
     void update_respawns(float dt);
     
@@ -214,7 +260,7 @@ private:
     void update_generators(float dt);
     void spawn_item(const GeneratorState& gen);
     void update_items(float dt);
-    void process_item_pickup(engine::PlayerId playerId);
+    void apply_item_pickup(engine::PlayerId playerId, PlayerState& player, std::uint32_t itemId);
     std::uint32_t next_entity_id();
     
     // --- Beds ---
@@ -226,11 +272,25 @@ private:
     static proto::TeamId block_type_to_team(shared::voxel::BlockType bt);
     
     // --- Helpers ---
-    void send_message(engine::PlayerId id, const proto::Message& msg);
+    void send_message(engine::PlayerId id, const proto::Message& msg,
+                      engine::Delivery delivery = engine::Delivery::ReliableOrdered);
     void broadcast_message(const proto::Message& msg);
-    void send_chunk_data(engine::PlayerId id, int chunkX, int chunkZ);
+    std::size_t send_chunk_data(engine::PlayerId id, int chunkX, int chunkZ);  // Returns bytes sent
+    void begin_world_sync(engine::PlayerId id, PlayerState& player);
+    void update_world_sync();
+    void send_entity_snapshots();
     
     // --- Physics ---
+    
+    // Item a player moved into this tick; order indexes simOrder_
+    struct PickupClaim {
+        std::uint32_t order;
+        std::uint32_t itemId;
+    };
+    
+    void simulate_players(float dt);
+    void collect_item_pickups(std::uint32_t order, const PlayerState& player,
+                              std::vector<PickupClaim>& out) const;
     void simulate_player(PlayerState& player, float dt);
     void simulate_editor_camera(PlayerState& player, float dt);
     bool check_collision_at(float px, float py, float pz) const;
@@ -260,10 +320,22 @@ private:
     // Generators
     std::vector<GeneratorState> generators_;
     
-    // Dropped items
-    std::vector<DroppedItemState> droppedItems_;
+    // Dropped item stacks; pool ids are the replicated entity ids
+    game::StablePool<DroppedItemState> droppedItems_;
+    engine::SpatialGrid itemGrid_{kItemGridCellSize};
+    
+    // Player simulation phase: movement runs on simPool_ in simOrder_ (sorted
+    // by id); pickups land in per-lane claim lists and are applied in order.
+    std::unique_ptr<engine::ThreadPool> simPool_;
+    std::vector<std::pair<engine::PlayerId, PlayerState*>> simOrder_;
+    std::vector<std::vector<PickupClaim>> laneClaims_;
+    std::vector<PickupClaim> pickupClaims_;
+    
     std::uint32_t nextEntityId_{1};
     
+    // Quantized state of every joined player, rebuilt each tick for snapshots
+    proto::snapshot_codec::EntityList snapshotEntities_;
+    
     // Map template info
     bool hasMapTemplate_{false};
     std::string mapId_;
@@ -272,16 +344,21 @@ private:
     float mapCenterZ_{0.0f};
     float spawnY_{80.0f};
     
+    // Tick profiler phases (registered in on_init when profiling is enabled)
+    struct ProfilePhases {
+        engine::TickProfiler::PhaseId matchPhase{engine::TickProfiler::kInvalidPhase};
+        engine::TickProfiler::PhaseId generators{engine::TickProfiler::kInvalidPhase};
+        engine::TickProfiler::PhaseId items{engine::TickProfiler::kInvalidPhase};
+        engine::TickProfiler::PhaseId combat{engine::TickProfiler::kInvalidPhase};
+        engine::TickProfiler::PhaseId simulatePlayers{engine::TickProfiler::kInvalidPhase};
+        engine::TickProfiler::PhaseId snapshots{engine::TickProfiler::kInvalidPhase};
+        engine::TickProfiler::PhaseId worldSync{engine::TickProfiler::kInvalidPhase};
+    };
+    engine::TickProfiler* profiler_{nullptr};
+    ProfilePhases phases_{};
+    
     // Scripting engine (game scripts + map scripts)
     std::unique_ptr<bedwars::scripting::BedWarsScriptEngine> scriptEngine_;
-    
-    // Track modified blocks (for sending delta to new clients)
-    struct ModifiedBlock {
-        int x, y, z;
-        shared::voxel::BlockType type;
-        std::uint8_t state;
-    };
-    std::vector<ModifiedBlock> modifiedBlocks_;
 };
 
 } // namespace bedwars::server
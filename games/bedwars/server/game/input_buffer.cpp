@@ -0,0 +1,132 @@
+#include "input_buffer.hpp"
+
+#include <algorithm>
+
+namespace bedwars::server::game {
+
+namespace {
+
+// Signed distance a - b on the wrapping seq space.
+std::int32_t seq_diff(std::uint32_t a, std::uint32_t b) {
+    return static_cast<std::int32_t>(a - b);
+}
+
+} // namespace
+
+bool InputBuffer::push(const proto::InputFrame& frame) {
+    if (!started_) {
+        started_ = true;
+        nextSeq_ = endSeq_ = frame.seq;
+    }
+
+    constexpr std::int32_t kWindow = static_cast<std::int32_t>(kCapacity);
+    std::int32_t ahead = seq_diff(frame.seq, nextSeq_);
+    if (ahead >= kWindow || ahead <= -kWindow) {
+        // Far behind: the client restarted its sequence. Far ahead: we are
+        // hopelessly behind. Either way, resync here.
+        for (auto& s : slots_) s.filled = false;
+        nextSeq_ = endSeq_ = frame.seq;
+        primed_ = false;
+        ahead = 0;
+    }
+    if (ahead < 0) {
+        // Late copy of an input already simulated
+        ++stats_.dropped;
+        return false;
+    }
+
+    Slot& s = slot(frame.seq);
+    if (s.filled && s.frame.seq == frame.seq) {
+        ++stats_.dropped;
+        return false;
+    }
+    s.frame = frame;
+    s.filled = true;
+    if (seq_diff(frame.seq + 1, endSeq_) > 0) {
+        endSeq_ = frame.seq + 1;
+    }
+    return true;
+}
+
+std::uint32_t InputBuffer::queued() const {
+    return started_ ? endSeq_ - nextSeq_ : 0;
+}
+
+std::uint32_t InputBuffer::take_for_tick(Batch& out) {
+    const std::uint32_t avail = queued();
+
+    if (avail == 0 && primed_) {
+        // Ran dry: hold a bigger reserve and refill it before resuming.
+        ++stats_.starved;
+        reserve_ = std::min(reserve_ + 1, kMaxReserve);
+        primed_ = false;
+        windowTicks_ = 0;
+        minLeftOver_ = kCapacity;
+    }
+    if (!primed_ && avail > reserve_) {
+        primed_ = true;
+    }
+
+    if (!primed_) {
+        if (++starvedRun_ < kIdleAfterTicks) return 0;
+
+        proto::InputFrame idle = last_;
+        idle.moveX = 0.0f;
+        idle.moveY = 0.0f;
+        idle.jump = false;
+        idle.sprint = false;
+        idle.camUp = false;
+        idle.camDown = false;
+        out[0] = idle;
+        return 1;
+    }
+    starvedRun_ = 0;
+
+    // One input per tick, plus whatever sits above the reserve.
+    const std::uint32_t count = std::clamp(avail > reserve_ ? avail - reserve_ : 1u, 1u, kMaxInputsPerTick);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        Slot& s = slot(nextSeq_);
+        if (s.filled && s.frame.seq == nextSeq_) {
+            last_ = s.frame;
+        } else {
+            // Lost in transit: repeat the previous input in its place
+            ++stats_.lost;
+            last_.seq = nextSeq_;
+        }
+        s.filled = false;
+        out[i] = last_;
+        lastSeq_ = nextSeq_++;
+    }
+
+    adapt(avail - count);
+    return count;
+}
+
+void InputBuffer::take_latest() {
+    for (; queued() > 0; ++nextSeq_) {
+        Slot& s = slot(nextSeq_);
+        if (s.filled && s.frame.seq == nextSeq_) {
+            last_ = s.frame;
+        }
+        s.filled = false;
+        lastSeq_ = nextSeq_;
+    }
+}
+
+void InputBuffer::adapt(std::uint32_t leftOver) {
+    minLeftOver_ = std::min(minLeftOver_, leftOver);
+    if (++windowTicks_ < kAdaptWindowTicks) return;
+
+    // Queue never came close to running dry for a whole window: shrink
+    if (minLeftOver_ > 0 && reserve_ > 0) {
+        --reserve_;
+    }
+    windowTicks_ = 0;
+    minLeftOver_ = kCapacity;
+}
+
+void InputBuffer::clear() {
+    *this = InputBuffer{};
+}
+
+} // namespace bedwars::server::game
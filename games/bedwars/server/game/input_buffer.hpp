@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../../shared/protocol/messages.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace bedwars::server::game {
+
+// Per-player queue of InputFrames keyed by seq.
+// Clients send one input per server tick; every input is simulated exactly
+// once, in seq order. A small jitter reserve absorbs uneven arrival: it grows
+// when the queue runs dry and shrinks after a stretch where it was never
+// needed. Inputs lost on the unreliable channel are replaced by the previous
+// one so the step count still matches the client's.
+class InputBuffer {
+public:
+    static constexpr std::size_t kCapacity = 64;
+    static constexpr std::uint32_t kMaxInputsPerTick = 4;
+    static constexpr std::uint32_t kMaxReserve = 6;
+    static constexpr std::uint32_t kAdaptWindowTicks = 90;
+    // Without input for this long, step with movement released so the player
+    // still falls and settles (menus, stalled clients).
+    static constexpr std::uint32_t kIdleAfterTicks = 8;
+
+    using Batch = std::array<proto::InputFrame, kMaxInputsPerTick>;
+
+    struct Stats {
+        std::uint64_t lost{0};      // gaps filled with the previous input
+        std::uint64_t dropped{0};   // duplicates and inputs already simulated
+        std::uint64_t starved{0};   // ticks with nothing to simulate
+    };
+
+    // Queue an input. Returns false if it was a duplicate or already simulated.
+    // A seq a whole buffer away from the next one to simulate, in either
+    // direction (e.g. a client that restarted at 1), resyncs the queue.
+    bool push(const proto::InputFrame& frame);
+
+    // Inputs to simulate this tick, oldest first. Returns 0 while the reserve
+    // fills and during short stalls.
+    std::uint32_t take_for_tick(Batch& out);
+
+    // Consume everything queued, keeping only the newest as last()
+    // (editor camera: one step per tick with the latest state).
+    void take_latest();
+
+    // Most recent input handed out (defaults before the first one).
+    const proto::InputFrame& last() const { return last_; }
+
+    // seq of the newest simulated input; 0 before the first.
+    std::uint32_t last_processed_seq() const { return lastSeq_; }
+
+    std::uint32_t reserve() const { return reserve_; }
+    std::uint32_t queued() const;
+    const Stats& stats() const { return stats_; }
+
+    void clear();
+
+private:
+    struct Slot {
+        proto::InputFrame frame{};
+        bool filled{false};
+    };
+
+    Slot& slot(std::uint32_t seq) { return slots_[seq % kCapacity]; }
+    void adapt(std::uint32_t leftOver);
+
+    std::array<Slot, kCapacity> slots_{};
+    bool started_{false};
+    bool primed_{false};
+    std::uint32_t nextSeq_{0};   // first seq not yet simulated
+    std::uint32_t endSeq_{0};    // one past the highest seq received
+    std::uint32_t lastSeq_{0};
+    proto::InputFrame last_{};
+
+    std::uint32_t reserve_{1};
+    std::uint32_t minLeftOver_{kCapacity};
+    std::uint32_t windowTicks_{0};
+    std::uint32_t starvedRun_{0};
+
+    Stats stats_;
+};
+
+} // namespace bedwars::server::game
@@ -0,0 +1,42 @@
+#include "position_history.hpp"
+
+namespace bedwars::server::game {
+
+void PositionHistory::record(engine::Tick tick, float x, float y, float z) {
+    ticks_[head_] = tick;
+    x_[head_] = x;
+    y_[head_] = y;
+    z_[head_] = z;
+    head_ = (head_ + 1) % kCapacity;
+    if (count_ < kCapacity) ++count_;
+}
+
+bool PositionHistory::sample(double tick, float& x, float& y, float& z) const {
+    if (count_ == 0) return false;
+
+    // Walk back from the newest to the first sample at or before tick
+    std::size_t newer = newest();
+    for (std::size_t back = 0; back < count_; ++back) {
+        const std::size_t i = index(back);
+        const double t = static_cast<double>(ticks_[i]);
+        if (t <= tick) {
+            if (back == 0) break;  // at or past the newest: clamp
+            const double span = static_cast<double>(ticks_[newer]) - t;
+            const auto a = static_cast<float>((tick - t) / span);
+            x = x_[i] + (x_[newer] - x_[i]) * a;
+            y = y_[i] + (y_[newer] - y_[i]) * a;
+            z = z_[i] + (z_[newer] - z_[i]) * a;
+            return true;
+        }
+        newer = i;
+    }
+
+    // Newer than everything (use newest) or older than everything (use oldest)
+    const std::size_t i = tick >= static_cast<double>(ticks_[newest()]) ? newest() : index(count_ - 1);
+    x = x_[i];
+    y = y_[i];
+    z = z_[i];
+    return true;
+}
+
+} // namespace bedwars::server::game
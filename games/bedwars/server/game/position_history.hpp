@@ -0,0 +1,45 @@
+#pragma once
+
+#include <engine/core/types.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace bedwars::server::game {
+
+// Per-player ring of past positions, one sample per server tick, used to
+// rewind a target to the moment an attacker saw it. Storage is fixed SoA
+// arrays: recording writes one slot in each and never allocates.
+class PositionHistory {
+public:
+    static constexpr std::size_t kCapacity = 32;  // ~1 s at 30 TPS
+
+    // Store the position at the end of tick. Ticks must increase.
+    void record(engine::Tick tick, float x, float y, float z);
+
+    // Position at a (fractional) tick, interpolated between neighbouring
+    // samples and clamped to the oldest/newest one. False if empty.
+    bool sample(double tick, float& x, float& y, float& z) const;
+
+    bool empty() const { return count_ == 0; }
+    engine::Tick newest_tick() const { return count_ ? ticks_[newest()] : 0; }
+    engine::Tick oldest_tick() const { return count_ ? ticks_[index(count_ - 1)] : 0; }
+
+    // Forget everything (teleports: never blend across one).
+    void clear() { count_ = 0; }
+
+private:
+    std::size_t newest() const { return (head_ + kCapacity - 1) % kCapacity; }
+    // i-th sample counting back from the newest
+    std::size_t index(std::size_t back) const { return (head_ + kCapacity - 1 - back) % kCapacity; }
+
+    std::array<engine::Tick, kCapacity> ticks_{};
+    std::array<float, kCapacity> x_{};
+    std::array<float, kCapacity> y_{};
+    std::array<float, kCapacity> z_{};
+    std::size_t head_{0};   // next slot to write
+    std::size_t count_{0};
+};
+
+} // namespace bedwars::server::game
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace bedwars::server::game {
+
+// Free-list pool of T addressed by stable 32-bit ids.
+// An id packs the slot index with the slot's generation, so lookups are a
+// single array access and an id stays valid until its own object is
+// destroyed: a reused slot gets a new generation and old ids miss. Slots are
+// never moved or compacted; freed ones are handed out again first.
+template <typename T>
+class StablePool {
+public:
+    using Id = std::uint32_t;
+
+    static constexpr unsigned kIndexBits = 20;  // up to ~1M live objects
+    static constexpr Id kIndexMask = (Id{1} << kIndexBits) - 1;
+    static constexpr Id kMaxGeneration = ~Id{0} >> kIndexBits;
+    static constexpr Id kInvalidId = 0;  // generations start at 1
+
+    // Store value and return its id (kInvalidId when the pool is full).
+    Id create(T value) {
+        std::uint32_t index;
+        if (freeHead_ != kNoFree) {
+            index = freeHead_;
+            freeHead_ = slots_[index].nextFree;
+        } else {
+            if (slots_.size() > kIndexMask) return kInvalidId;
+            index = static_cast<std::uint32_t>(slots_.size());
+            slots_.emplace_back();
+        }
+
+        Slot& s = slots_[index];
+        s.value = std::move(value);
+        s.alive = true;
+        ++live_;
+        return make_id(index, s.generation);
+    }
+
+    // Free the object; returns false for stale or unknown ids.
+    bool destroy(Id id) {
+        Slot* s = find(id);
+        if (!s) return false;
+
+        s->alive = false;
+        s->value = T{};
+        s->generation = s->generation == kMaxGeneration ? 1 : s->generation + 1;
+        s->nextFree = freeHead_;
+        freeHead_ = id & kIndexMask;
+        --live_;
+        return true;
+    }
+
+    T* get(Id id) {
+        Slot* s = find(id);
+        return s ? &s->value : nullptr;
+    }
+
+    const T* get(Id id) const {
+        return const_cast<StablePool*>(this)->get(id);
+    }
+
+    // Call fn(id, value) for every live object in slot order. fn may
+    // destroy the object it was called for.
+    template <typename Fn>
+    void for_each(Fn&& fn) {
+        for (std::uint32_t i = 0; i < slots_.size(); ++i) {
+            if (slots_[i].alive) {
+                fn(make_id(i, slots_[i].generation), slots_[i].value);
+            }
+        }
+    }
+
+    std::size_t size() const { return live_; }
+    std::size_t capacity() const { return slots_.size(); }
+
+    void clear() {
+        slots_.clear();
+        freeHead_ = kNoFree;
+        live_ = 0;
+    }
+
+private:
+    static constexpr std::uint32_t kNoFree = ~std::uint32_t{0};
+
+    struct Slot {
+        T value{};
+        Id generation{1};
+        std::uint32_t nextFree{kNoFree};
+        bool alive{false};
+    };
+
+    static Id make_id(std::uint32_t index, Id generation) {
+        return (generation << kIndexBits) | index;
+    }
+
+    Slot* find(Id id) {
+        const std::uint32_t index = id & kIndexMask;
+        if (index >= slots_.size()) return nullptr;
+        Slot& s = slots_[index];
+        return (s.alive && s.generation == (id >> kIndexBits)) ? &s : nullptr;
+    }
+
+    std::vector<Slot> slots_;
+    std::uint32_t freeHead_{kNoFree};
+    std::size_t live_{0};
+};
+
+} // namespace bedwars::server::game
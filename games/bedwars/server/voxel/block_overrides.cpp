@@ -0,0 +1,209 @@
+#include "block_overrides.hpp"
+
+#include <algorithm>
+
+namespace bedwars::voxel {
+
+// ============================================================================
+// Type / state / flag setters
+// ============================================================================
+
+void BlockOverrides::set_type(int x, int y, int z, shared::voxel::BlockType type) {
+    Section* s = section_for_write(x, y, z);
+    if (!s) return;
+    auto& slot = s->types[cell_index(x, y, z)];
+    if (slot == kNoValue) {
+        ++s->typeCount;
+        ++typeCount_;
+    }
+    slot = static_cast<std::uint8_t>(type);
+}
+
+void BlockOverrides::erase_type(int x, int y, int z) {
+    Section* s = existing_section(x, y, z);
+    if (!s) return;
+    auto& slot = s->types[cell_index(x, y, z)];
+    if (slot == kNoValue) return;
+    slot = kNoValue;
+    --s->typeCount;
+    --typeCount_;
+    release_if_unused(x, y, z);
+}
+
+void BlockOverrides::set_state(int x, int y, int z, shared::voxel::BlockRuntimeState state) {
+    Section* s = section_for_write(x, y, z);
+    if (!s) return;
+    auto& slot = s->states[cell_index(x, y, z)];
+    if (slot == kNoValue) {
+        ++s->stateCount;
+    }
+    slot = state.to_byte();
+}
+
+void BlockOverrides::erase_state(int x, int y, int z) {
+    Section* s = existing_section(x, y, z);
+    if (!s) return;
+    auto& slot = s->states[cell_index(x, y, z)];
+    if (slot == kNoValue) return;
+    slot = kNoValue;
+    --s->stateCount;
+    release_if_unused(x, y, z);
+}
+
+void BlockOverrides::set_player_placed(int x, int y, int z, bool placed) {
+    if (!placed) {
+        Section* s = existing_section(x, y, z);
+        if (!s) return;
+        const std::size_t idx = cell_index(x, y, z);
+        if (!s->placed.test(idx)) return;
+        s->placed.reset(idx);
+        --s->placedCount;
+        release_if_unused(x, y, z);
+        return;
+    }
+
+    Section* s = section_for_write(x, y, z);
+    if (!s) return;
+    const std::size_t idx = cell_index(x, y, z);
+    if (s->placed.test(idx)) return;
+    s->placed.set(idx);
+    ++s->placedCount;
+}
+
+void BlockOverrides::apply_chunk_types(int chunkX, int chunkZ, std::uint8_t* out) const {
+    if (typeCount_ == 0) return;
+    const Column* column = find_column(chunkX, chunkZ);
+    if (!column) return;
+
+    // Section cell order matches the chunk's Y-major layout, so section sy
+    // maps onto a contiguous 4096-byte slice of the output.
+    for (int sy = 0; sy < kSectionsPerColumn; ++sy) {
+        const Section* s = column->sections[static_cast<std::size_t>(sy)].get();
+        if (!s || s->typeCount == 0) continue;
+        std::uint8_t* dst = out + static_cast<std::size_t>(sy) * kSectionVolume;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(kSectionVolume); ++i) {
+            const std::uint8_t raw = s->types[i];
+            if (raw != kNoValue) dst[i] = raw;
+        }
+    }
+}
+
+void BlockOverrides::clear() {
+    grid_.clear();
+    gridMinX_ = gridMinZ_ = 0;
+    gridWidth_ = gridDepth_ = 0;
+    far_.clear();
+    typeCount_ = 0;
+}
+
+// ============================================================================
+// Section / column allocation
+// ============================================================================
+
+BlockOverrides::Section* BlockOverrides::existing_section(int x, int y, int z) {
+    return const_cast<Section*>(find_section(x, y, z));
+}
+
+BlockOverrides::Section* BlockOverrides::section_for_write(int x, int y, int z) {
+    if (y < 0 || y >= shared::voxel::CHUNK_HEIGHT) return nullptr;
+    auto& slot = column_for_write(x >> 4, z >> 4).sections[static_cast<std::size_t>(y >> 4)];
+    if (!slot) {
+        slot = std::make_unique<Section>();
+    }
+    return slot.get();
+}
+
+void BlockOverrides::release_if_unused(int x, int y, int z) {
+    // Empty columns are kept (a handful of pointers); empty sections are freed.
+    auto* column = const_cast<Column*>(find_column(x >> 4, z >> 4));
+    if (!column) return;
+    auto& slot = column->sections[static_cast<std::size_t>(y >> 4)];
+    if (slot && slot->unused()) {
+        slot.reset();
+    }
+}
+
+BlockOverrides::Column& BlockOverrides::column_for_write(int cx, int cz) {
+    if (auto* existing = const_cast<Column*>(find_column(cx, cz))) {
+        return *existing;
+    }
+
+    if (grow_grid_to_include(cx, cz)) {
+        auto& slot = grid_[static_cast<std::size_t>(cz - gridMinZ_) * static_cast<std::size_t>(gridWidth_) +
+                           static_cast<std::size_t>(cx - gridMinX_)];
+        slot = std::make_unique<Column>();
+        return *slot;
+    }
+
+    auto& slot = far_[ColumnKey{cx, cz}];
+    slot = std::make_unique<Column>();
+    return *slot;
+}
+
+bool BlockOverrides::grow_grid_to_include(int cx, int cz) {
+    if (gridWidth_ == 0) {
+        // First edit: start with a small window around it.
+        constexpr int kInitialHalfExtent = 4;
+        gridMinX_ = cx - kInitialHalfExtent;
+        gridMinZ_ = cz - kInitialHalfExtent;
+        gridWidth_ = gridDepth_ = kInitialHalfExtent * 2 + 1;
+        grid_.resize(static_cast<std::size_t>(gridWidth_) * static_cast<std::size_t>(gridDepth_));
+        return true;
+    }
+
+    if (cx >= gridMinX_ && cx < gridMinX_ + gridWidth_ && cz >= gridMinZ_ && cz < gridMinZ_ + gridDepth_) {
+        return true;
+    }
+
+    // Grow with slack on the side that needs it so repeated edits along an edge amortize.
+    const auto grow_axis = [](int value, int minV, int size, int* outMin, int* outSize) {
+        const int slack = std::max(4, size / 2);
+        int newMin = minV;
+        int newMax = minV + size - 1;
+        if (value < newMin) newMin = value - slack;
+        if (value > newMax) newMax = value + slack;
+        *outMin = newMin;
+        *outSize = newMax - newMin + 1;
+    };
+
+    int newMinX = 0, newWidth = 0, newMinZ = 0, newDepth = 0;
+    grow_axis(cx, gridMinX_, gridWidth_, &newMinX, &newWidth);
+    grow_axis(cz, gridMinZ_, gridDepth_, &newMinZ, &newDepth);
+
+    const auto newCount = static_cast<std::size_t>(newWidth) * static_cast<std::size_t>(newDepth);
+    if (newWidth <= 0 || newDepth <= 0 || newCount > kMaxGridColumns) {
+        return false;
+    }
+
+    std::vector<std::unique_ptr<Column>> grown(newCount);
+    for (int z = 0; z < gridDepth_; ++z) {
+        for (int x = 0; x < gridWidth_; ++x) {
+            auto& src = grid_[static_cast<std::size_t>(z) * static_cast<std::size_t>(gridWidth_) + static_cast<std::size_t>(x)];
+            if (!src) continue;
+            const int nx = gridMinX_ + x - newMinX;
+            const int nz = gridMinZ_ + z - newMinZ;
+            grown[static_cast<std::size_t>(nz) * static_cast<std::size_t>(newWidth) + static_cast<std::size_t>(nx)] = std::move(src);
+        }
+    }
+
+    grid_ = std::move(grown);
+    gridMinX_ = newMinX;
+    gridMinZ_ = newMinZ;
+    gridWidth_ = newWidth;
+    gridDepth_ = newDepth;
+
+    // Pull in far columns that now fit.
+    for (auto it = far_.begin(); it != far_.end();) {
+        const int ux = it->first.cx - gridMinX_;
+        const int uz = it->first.cz - gridMinZ_;
+        if (ux >= 0 && ux < gridWidth_ && uz >= 0 && uz < gridDepth_) {
+            grid_[static_cast<std::size_t>(uz) * static_cast<std::size_t>(gridWidth_) + static_cast<std::size_t>(ux)] = std::move(it->second);
+            it = far_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    return true;
+}
+
+} // namespace bedwars::voxel
@@ -0,0 +1,217 @@
+#pragma once
+
+// =============================================================================
+// BlockOverrides - Chunk-indexed sparse storage for runtime terrain edits
+// Per-block override type, runtime state and player-placed flag, stored in
+// dense 16x16x16 sections that are allocated only for touched chunks.
+// =============================================================================
+
+#include "engine/modules/voxel/shared/block.hpp"
+#include "engine/modules/voxel/shared/block_state.hpp"
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace bedwars::voxel {
+
+class BlockOverrides {
+public:
+    static constexpr int kSectionSize = 16;
+    static constexpr int kSectionVolume = kSectionSize * kSectionSize * kSectionSize;
+    static constexpr int kSectionsPerColumn = shared::voxel::CHUNK_HEIGHT / kSectionSize;
+
+    // Columns are kept in a dense grid covering the bounding rectangle of touched
+    // chunks. Edits that would stretch the grid past this fall back to a map.
+    static constexpr std::size_t kMaxGridColumns = 64 * 1024;
+
+    BlockOverrides() = default;
+    BlockOverrides(BlockOverrides&&) noexcept = default;
+    BlockOverrides& operator=(BlockOverrides&&) noexcept = default;
+
+    // --- Block type overrides ---
+
+    bool find_type(int x, int y, int z, shared::voxel::BlockType* out) const {
+        const Section* s = find_section(x, y, z);
+        if (!s) return false;
+        const std::uint8_t raw = s->types[cell_index(x, y, z)];
+        if (raw == kNoValue) return false;
+        *out = static_cast<shared::voxel::BlockType>(raw);
+        return true;
+    }
+
+    void set_type(int x, int y, int z, shared::voxel::BlockType type);
+    void erase_type(int x, int y, int z);
+    std::size_t type_count() const { return typeCount_; }
+    bool empty() const { return typeCount_ == 0; }
+
+    // --- Runtime block state (connections, slab type) ---
+
+    bool find_state(int x, int y, int z, shared::voxel::BlockRuntimeState* out) const {
+        const Section* s = find_section(x, y, z);
+        if (!s) return false;
+        const std::uint8_t raw = s->states[cell_index(x, y, z)];
+        if (raw == kNoValue) return false;
+        *out = shared::voxel::BlockRuntimeState::from_byte(raw);
+        return true;
+    }
+
+    void set_state(int x, int y, int z, shared::voxel::BlockRuntimeState state);
+    void erase_state(int x, int y, int z);
+
+    // --- Player-placed flag ---
+
+    bool is_player_placed(int x, int y, int z) const {
+        const Section* s = find_section(x, y, z);
+        return s && s->placed.test(cell_index(x, y, z));
+    }
+
+    void set_player_placed(int x, int y, int z, bool placed);
+
+    // Visit every type override as fn(x, y, z, type). Grid columns are visited
+    // in memory order (then any far columns), each bottom-up in section order.
+    template <typename Fn>
+    void for_each_type(Fn&& fn) const {
+        if (typeCount_ == 0) return;
+        for (std::size_t i = 0; i < grid_.size(); ++i) {
+            if (!grid_[i]) continue;
+            const int cx = gridMinX_ + static_cast<int>(i % static_cast<std::size_t>(gridWidth_));
+            const int cz = gridMinZ_ + static_cast<int>(i / static_cast<std::size_t>(gridWidth_));
+            visit_column_types(*grid_[i], cx, cz, fn);
+        }
+        for (const auto& [key, column] : far_) {
+            visit_column_types(*column, key.cx, key.cz, fn);
+        }
+    }
+
+    // Visit the type overrides of one chunk column, bottom-up.
+    template <typename Fn>
+    void for_each_type_in_chunk(int chunkX, int chunkZ, Fn&& fn) const {
+        if (typeCount_ == 0) return;
+        if (const Column* column = find_column(chunkX, chunkZ)) {
+            visit_column_types(*column, chunkX, chunkZ, fn);
+        }
+    }
+
+    // Visit fn(chunkX, chunkZ) for every chunk column holding type overrides,
+    // in the same order as for_each_type.
+    template <typename Fn>
+    void for_each_modified_chunk(Fn&& fn) const {
+        if (typeCount_ == 0) return;
+        for (std::size_t i = 0; i < grid_.size(); ++i) {
+            if (!grid_[i] || !has_types(*grid_[i])) continue;
+            fn(gridMinX_ + static_cast<int>(i % static_cast<std::size_t>(gridWidth_)),
+               gridMinZ_ + static_cast<int>(i / static_cast<std::size_t>(gridWidth_)));
+        }
+        for (const auto& [key, column] : far_) {
+            if (has_types(*column)) fn(key.cx, key.cz);
+        }
+    }
+
+    // Overwrite out[] (one chunk column, y * 256 + z * 16 + x order) with this
+    // chunk's type overrides. Only sections that hold overrides are touched.
+    void apply_chunk_types(int chunkX, int chunkZ, std::uint8_t* out) const;
+
+    void clear();
+
+private:
+    static constexpr std::uint8_t kNoValue = 0xFF;
+
+    struct Section {
+        Section() { types.fill(kNoValue); states.fill(kNoValue); }
+
+        // Index: ly * 256 + lz * 16 + lx, matching the chunk wire order.
+        std::array<std::uint8_t, kSectionVolume> types;
+        std::array<std::uint8_t, kSectionVolume> states;
+        std::bitset<kSectionVolume> placed;
+        std::uint16_t typeCount{0};
+        std::uint16_t stateCount{0};
+        std::uint16_t placedCount{0};
+
+        bool unused() const { return typeCount == 0 && stateCount == 0 && placedCount == 0; }
+    };
+
+    struct Column {
+        std::array<std::unique_ptr<Section>, kSectionsPerColumn> sections;
+    };
+
+    struct ColumnKey {
+        int cx{0};
+        int cz{0};
+        bool operator==(const ColumnKey& other) const { return cx == other.cx && cz == other.cz; }
+    };
+
+    struct ColumnKeyHash {
+        std::size_t operator()(const ColumnKey& k) const {
+            return (static_cast<std::size_t>(static_cast<std::uint32_t>(k.cx)) << 32) ^
+                   static_cast<std::size_t>(static_cast<std::uint32_t>(k.cz));
+        }
+    };
+
+    static std::size_t cell_index(int x, int y, int z) {
+        return static_cast<std::size_t>(((y & 15) << 8) | ((z & 15) << 4) | (x & 15));
+    }
+
+    const Column* find_column(int cx, int cz) const {
+        const auto ux = static_cast<unsigned>(cx - gridMinX_);
+        const auto uz = static_cast<unsigned>(cz - gridMinZ_);
+        if (ux < static_cast<unsigned>(gridWidth_) && uz < static_cast<unsigned>(gridDepth_)) {
+            return grid_[static_cast<std::size_t>(uz) * static_cast<std::size_t>(gridWidth_) + ux].get();
+        }
+        if (far_.empty()) return nullptr;
+        const auto it = far_.find(ColumnKey{cx, cz});
+        return it == far_.end() ? nullptr : it->second.get();
+    }
+
+    const Section* find_section(int x, int y, int z) const {
+        if (y < 0 || y >= shared::voxel::CHUNK_HEIGHT) return nullptr;
+        const Column* column = find_column(x >> 4, z >> 4);
+        return column ? column->sections[static_cast<std::size_t>(y >> 4)].get() : nullptr;
+    }
+
+    static bool has_types(const Column& column) {
+        for (const auto& s : column.sections) {
+            if (s && s->typeCount != 0) return true;
+        }
+        return false;
+    }
+
+    template <typename Fn>
+    static void visit_column_types(const Column& column, int cx, int cz, Fn& fn) {
+        for (int sy = 0; sy < kSectionsPerColumn; ++sy) {
+            const Section* s = column.sections[static_cast<std::size_t>(sy)].get();
+            if (!s || s->typeCount == 0) continue;
+            for (int i = 0; i < kSectionVolume; ++i) {
+                const std::uint8_t raw = s->types[static_cast<std::size_t>(i)];
+                if (raw == kNoValue) continue;
+                fn(cx * kSectionSize + (i & 15), sy * kSectionSize + (i >> 8),
+                   cz * kSectionSize + ((i >> 4) & 15), static_cast<shared::voxel::BlockType>(raw));
+            }
+        }
+    }
+
+    // Returns nullptr when y is out of range.
+    Section* section_for_write(int x, int y, int z);
+    Section* existing_section(int x, int y, int z);
+    void release_if_unused(int x, int y, int z);
+    Column& column_for_write(int cx, int cz);
+    bool grow_grid_to_include(int cx, int cz);
+
+    // Dense column grid; cell (cx, cz) lives at (cz - gridMinZ_) * gridWidth_ + (cx - gridMinX_).
+    std::vector<std::unique_ptr<Column>> grid_;
+    int gridMinX_{0};
+    int gridMinZ_{0};
+    int gridWidth_{0};
+    int gridDepth_{0};
+
+    // Columns that did not fit in the grid budget.
+    std::unordered_map<ColumnKey, std::unique_ptr<Column>, ColumnKeyHash> far_;
+
+    std::size_t typeCount_{0};
+};
+
+} // namespace bedwars::voxel
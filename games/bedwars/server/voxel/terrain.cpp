@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <random>
 
 namespace bedwars::voxel {
@@ -37,17 +38,19 @@ int Terrain::floor_div_(int a, int b) {
     return -(((-a) + b - 1) / b);
 }
 
-void Terrain::set_map_template(shared::maps::MapTemplate map) {
+void Terrain::set_map_template(shared::maps::SharedMapTemplate map) {
     map_template_ = std::move(map);
     // Keep runtime overrides, but drop any that are now redundant.
     if (!overrides_.empty()) {
-        for (auto it = overrides_.begin(); it != overrides_.end();) {
-            const auto base = get_template_block_(it->first.x, it->first.y, it->first.z);
-            if (it->second == base && player_placed_.find(it->first) == player_placed_.end()) {
-                it = overrides_.erase(it);
-            } else {
-                ++it;
+        struct Pos { int x, y, z; };
+        std::vector<Pos> redundant;
+        overrides_.for_each_type([&](int x, int y, int z, shared::voxel::BlockType type) {
+            if (type == get_template_block_(x, y, z) && !overrides_.is_player_placed(x, y, z)) {
+                redundant.push_back({x, y, z});
             }
+        });
+        for (const auto& p : redundant) {
+            overrides_.erase_type(p.x, p.y, p.z);
         }
     }
     
@@ -93,17 +96,14 @@ void Terrain::set_override_(int x, int y, int z, shared::voxel::BlockType type,
         return;
     }
 
-    const BlockKey key{x, y, z};
     const auto base = map_template_ ? get_template_block_(x, y, z) : get_base_block_(x, y, z);
 
     if (!keep_if_matches_base && type == base) {
-        if (!overrides_.empty()) {
-            overrides_.erase(key);
-        }
+        overrides_.erase_type(x, y, z);
         return;
     }
 
-    overrides_[key] = type;
+    overrides_.set_type(x, y, z, type);
 }
 
 void Terrain::place_player_block(int x, int y, int z, shared::voxel::BlockType type) {
@@ -111,8 +111,7 @@ void Terrain::place_player_block(int x, int y, int z, shared::voxel::BlockType t
         return;
     }
 
-    const BlockKey key{x, y, z};
-    player_placed_.insert(key);
+    overrides_.set_player_placed(x, y, z, true);
 
     // Keep the override even if it matches the template/base block type.
     // This allows a player to rebuild a template block and still have it be breakable.
@@ -124,16 +123,14 @@ void Terrain::break_player_block(int x, int y, int z) {
         return;
     }
 
-    const BlockKey key{x, y, z};
-    player_placed_.erase(key);
+    overrides_.set_player_placed(x, y, z, false);
 
     // Breaking results in Air. If base/template is non-air, keep the override (represents broken template).
     set_override_(x, y, z, shared::voxel::BlockType::Air, /*keep_if_matches_base=*/false);
 }
 
 bool Terrain::is_player_placed(int x, int y, int z) const {
-    const BlockKey key{x, y, z};
-    return player_placed_.find(key) != player_placed_.end();
+    return overrides_.is_player_placed(x, y, z);
 }
 
 bool Terrain::can_player_break(int x, int y, int z, shared::voxel::BlockType current) const {
@@ -218,11 +215,19 @@ shared::voxel::BlockType Terrain::get_base_block_(int x, int y, int z) const {
         return BlockType::Air;
     }
 
+    return base_block_in_column_(x, y, z, base_height_(x, z));
+}
+
+int Terrain::base_height_(int x, int z) const {
     const float world_x = static_cast<float>(x);
     const float world_z = static_cast<float>(z);
 
     const float noise = octave_perlin_(world_x * 0.02f, world_z * 0.02f, 4, 0.5f);
-    const int height = static_cast<int>(60 + noise * 20);
+    return static_cast<int>(60 + noise * 20);
+}
+
+shared::voxel::BlockType Terrain::base_block_in_column_(int x, int y, int z, int height) const {
+    using shared::voxel::BlockType;
 
     if (y == 0) {
         return BlockType::Bedrock;
@@ -336,12 +341,9 @@ float Terrain::octave_perlin_(float x, float y, int octaves, float persistence)
 }
 
 shared::voxel::BlockType Terrain::get_block(int x, int y, int z) const {
-    if (!overrides_.empty()) {
-        const BlockKey key{x, y, z};
-        const auto it = overrides_.find(key);
-        if (it != overrides_.end()) {
-            return it->second;
-        }
+    shared::voxel::BlockType overridden;
+    if (overrides_.find_type(x, y, z, &overridden)) {
+        return overridden;
     }
 
     if (map_template_) {
@@ -359,14 +361,30 @@ void Terrain::set_block(int x, int y, int z, shared::voxel::BlockType type) {
 
 std::vector<Terrain::BlockModification> Terrain::get_all_modifications() const {
     std::vector<BlockModification> result;
-    result.reserve(overrides_.size());
-    for (const auto& [key, type] : overrides_) {
-        auto stateIt = block_states_.find(key);
-        shared::voxel::BlockRuntimeState state = (stateIt != block_states_.end()) 
-            ? stateIt->second 
-            : shared::voxel::BlockRuntimeState::defaults();
-        result.push_back({key.x, key.y, key.z, type, state});
-    }
+    result.reserve(overrides_.type_count());
+    overrides_.for_each_type([&](int x, int y, int z, shared::voxel::BlockType type) {
+        auto state = shared::voxel::BlockRuntimeState::defaults();
+        overrides_.find_state(x, y, z, &state);
+        result.push_back({x, y, z, type, state});
+    });
+    return result;
+}
+
+std::vector<std::pair<int, int>> Terrain::get_modified_chunks() const {
+    std::vector<std::pair<int, int>> result;
+    overrides_.for_each_modified_chunk([&](int cx, int cz) {
+        result.emplace_back(cx, cz);
+    });
+    return result;
+}
+
+std::vector<Terrain::BlockModification> Terrain::get_chunk_modifications(int chunkX, int chunkZ) const {
+    std::vector<BlockModification> result;
+    overrides_.for_each_type_in_chunk(chunkX, chunkZ, [&](int x, int y, int z, shared::voxel::BlockType type) {
+        auto state = shared::voxel::BlockRuntimeState::defaults();
+        overrides_.find_state(x, y, z, &state);
+        result.push_back({x, y, z, type, state});
+    });
     return result;
 }
 
@@ -375,10 +393,9 @@ std::vector<Terrain::BlockModification> Terrain::get_all_modifications() const {
 // ============================================================================
 
 shared::voxel::BlockRuntimeState Terrain::get_block_state(int x, int y, int z) const {
-    const BlockKey key{x, y, z};
-    auto it = block_states_.find(key);
-    if (it != block_states_.end()) {
-        return it->second;
+    shared::voxel::BlockRuntimeState stored;
+    if (overrides_.find_state(x, y, z, &stored)) {
+        return stored;
     }
     // Return default state based on block type
     auto type = get_block(x, y, z);
@@ -391,11 +408,10 @@ shared::voxel::BlockRuntimeState Terrain::get_block_state(int x, int y, int z) c
 }
 
 void Terrain::set_block_state(int x, int y, int z, shared::voxel::BlockRuntimeState state) {
-    const BlockKey key{x, y, z};
     if (state == shared::voxel::BlockRuntimeState::defaults()) {
-        block_states_.erase(key);
+        overrides_.erase_state(x, y, z);
     } else {
-        block_states_[key] = state;
+        overrides_.set_state(x, y, z, state);
     }
 }
 
@@ -471,38 +487,59 @@ std::vector<Terrain::BlockModification> Terrain::update_neighbor_states(int x, i
 }
 
 std::vector<std::uint8_t> Terrain::get_chunk_data(int chunkX, int chunkZ) const {
+    std::vector<std::uint8_t> blocks(static_cast<std::size_t>(shared::voxel::CHUNK_SIZE));
+    copy_chunk_blocks(chunkX, chunkZ, blocks);
+    return blocks;
+}
+
+void Terrain::copy_chunk_blocks(int chunkX, int chunkZ, std::span<std::uint8_t> out) const {
+    using shared::voxel::BlockType;
+
     constexpr int WIDTH = shared::voxel::CHUNK_WIDTH;
     constexpr int DEPTH = shared::voxel::CHUNK_DEPTH;
     constexpr int HEIGHT = shared::voxel::CHUNK_HEIGHT;
-    constexpr std::size_t CHUNK_SIZE = static_cast<std::size_t>(WIDTH) * 
-                                       static_cast<std::size_t>(DEPTH) * 
-                                       static_cast<std::size_t>(HEIGHT);
-
-    std::vector<std::uint8_t> blocks(CHUNK_SIZE);
-
-    const int worldBaseX = chunkX * WIDTH;
-    const int worldBaseZ = chunkZ * DEPTH;
-
-    // Fill chunk with block data
-    // Index order: y * (WIDTH * DEPTH) + z * WIDTH + x (local coords)
-    for (int y = 0; y < HEIGHT; ++y) {
-        for (int lz = 0; lz < DEPTH; ++lz) {
-            for (int lx = 0; lx < WIDTH; ++lx) {
-                const int worldX = worldBaseX + lx;
-                const int worldZ = worldBaseZ + lz;
-                
-                // get_block handles overrides, template, and base terrain
-                const auto blockType = get_block(worldX, y, worldZ);
-                
-                const std::size_t idx = static_cast<std::size_t>(y) * static_cast<std::size_t>(WIDTH * DEPTH) +
-                                        static_cast<std::size_t>(lz) * static_cast<std::size_t>(WIDTH) +
-                                        static_cast<std::size_t>(lx);
-                blocks[idx] = static_cast<std::uint8_t>(blockType);
+    constexpr std::size_t CHUNK_SIZE = static_cast<std::size_t>(shared::voxel::CHUNK_SIZE);
+    static_assert(sizeof(BlockType) == 1, "chunk copy assumes 1-byte block ids");
+
+    if (out.size() < CHUNK_SIZE) return;
+    std::uint8_t* dst = out.data();
+
+    if (map_template_) {
+        // Template chunks share the wire layout: one memcpy, or all Air outside the map.
+        const auto& b = map_template_->bounds;
+        const bool inBounds = chunkX >= b.chunkMinX && chunkX <= b.chunkMaxX &&
+                              chunkZ >= b.chunkMinZ && chunkZ <= b.chunkMaxZ;
+        const auto* chunk = inBounds ? map_template_->find_chunk(chunkX, chunkZ) : nullptr;
+        if (chunk) {
+            std::memcpy(dst, chunk->blocks.data(), CHUNK_SIZE);
+        } else {
+            std::memset(dst, static_cast<int>(BlockType::Air), CHUNK_SIZE);
+        }
+    } else {
+        std::memset(dst, static_cast<int>(BlockType::Air), CHUNK_SIZE);
+        if (!void_base_) {
+            // Procedural: one noise evaluation per column, everything above the
+            // surface/vegetation layer stays Air.
+            const int worldBaseX = chunkX * WIDTH;
+            const int worldBaseZ = chunkZ * DEPTH;
+            for (int lz = 0; lz < DEPTH; ++lz) {
+                for (int lx = 0; lx < WIDTH; ++lx) {
+                    const int worldX = worldBaseX + lx;
+                    const int worldZ = worldBaseZ + lz;
+                    const int height = base_height_(worldX, worldZ);
+                    const int top = std::min(height, HEIGHT - 1);
+                    for (int y = 0; y <= top; ++y) {
+                        const std::size_t idx = static_cast<std::size_t>(y) * static_cast<std::size_t>(WIDTH * DEPTH) +
+                                                static_cast<std::size_t>(lz) * static_cast<std::size_t>(WIDTH) +
+                                                static_cast<std::size_t>(lx);
+                        dst[idx] = static_cast<std::uint8_t>(base_block_in_column_(worldX, y, worldZ, height));
+                    }
+                }
             }
         }
     }
 
-    return blocks;
+    overrides_.apply_chunk_types(chunkX, chunkZ, dst);
 }
 
 } // namespace bedwars::voxel
@@ -5,11 +5,13 @@
 
 #include "engine/maps/rfmap_io.hpp"
 
+#include "block_overrides.hpp"
+
 #include <array>
 #include <cstdint>
 #include <optional>
-#include <unordered_map>
-#include <unordered_set>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace bedwars::voxel {
@@ -32,9 +34,12 @@ public:
     // Template blocks may be broken only if allow-listed in the template metadata.
     bool can_player_break(int x, int y, int z, shared::voxel::BlockType current) const;
 
-    bool has_map_template() const { return map_template_.has_value(); }
-    const shared::maps::MapTemplate* map_template() const { return map_template_ ? &*map_template_ : nullptr; }
-    void set_map_template(shared::maps::MapTemplate map);
+    bool has_map_template() const { return map_template_ != nullptr; }
+    const shared::maps::MapTemplate* map_template() const { return map_template_.get(); }
+    const shared::maps::SharedMapTemplate& shared_map_template() const { return map_template_; }
+
+    // The template is shared and never mutated; edits go to the overrides layer.
+    void set_map_template(shared::maps::SharedMapTemplate map);
 
     // Get all block modifications (for sending to new clients)
     struct BlockModification {
@@ -44,6 +49,11 @@ public:
     };
     std::vector<BlockModification> get_all_modifications() const;
 
+    // Chunk columns that hold modifications, and the modifications of one column
+    // (used to stream the world state to late joiners chunk by chunk).
+    std::vector<std::pair<int, int>> get_modified_chunks() const;
+    std::vector<BlockModification> get_chunk_modifications(int chunkX, int chunkZ) const;
+
     // Block state management
     shared::voxel::BlockRuntimeState get_block_state(int x, int y, int z) const;
     void set_block_state(int x, int y, int z, shared::voxel::BlockRuntimeState state);
@@ -59,6 +69,11 @@ public:
     // Returns block types in Y-major order: index = y * 256 + z * 16 + x (local coords)
     std::vector<std::uint8_t> get_chunk_data(int chunkX, int chunkZ) const;
 
+    // Bulk extraction into a caller buffer of CHUNK_SIZE bytes (same layout as above).
+    // Copies the template chunk (or generates the procedural column once per x/z)
+    // and then patches in this chunk's overrides.
+    void copy_chunk_blocks(int chunkX, int chunkZ, std::span<std::uint8_t> out) const;
+
     // Editor mode helper: when no map template is set, treat the base world as empty/void (all Air).
     // This ensures map exports contain only authored blocks, not procedural terrain.
     void set_void_base(bool enabled) { void_base_ = enabled; }
@@ -67,28 +82,9 @@ public:
     bool is_within_template_bounds(int x, int y, int z) const;
 
 private:
-    struct BlockKey {
-        int x{0};
-        int y{0};
-        int z{0};
-
-        bool operator==(const BlockKey& other) const {
-            return x == other.x && y == other.y && z == other.z;
-        }
-    };
-
-    struct BlockKeyHash {
-        std::size_t operator()(const BlockKey& k) const {
-            // Simple hash combine; good enough for sparse overrides.
-            std::size_t h = 1469598103934665603ull;
-            h ^= static_cast<std::size_t>(k.x) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
-            h ^= static_cast<std::size_t>(k.y) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
-            h ^= static_cast<std::size_t>(k.z) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
-            return h;
-        }
-    };
-
     shared::voxel::BlockType get_base_block_(int x, int y, int z) const;
+    int base_height_(int x, int z) const;
+    shared::voxel::BlockType base_block_in_column_(int x, int y, int z, int height) const;
     shared::voxel::BlockType get_template_block_(int x, int y, int z) const;
     static int floor_div_(int a, int b);
 
@@ -102,17 +98,12 @@ private:
 
     bool void_base_{false};
 
-    std::optional<shared::maps::MapTemplate> map_template_{};
-
-    // Sparse runtime modifications (placed/broken blocks) on top of procedural base terrain.
-    std::unordered_map<BlockKey, shared::voxel::BlockType, BlockKeyHash> overrides_{};
-    
-    // Block states for blocks that have non-default state (connections, slab type)
-    std::unordered_map<BlockKey, shared::voxel::BlockRuntimeState, BlockKeyHash> block_states_{};
+    shared::maps::SharedMapTemplate map_template_{};
 
-    // Positions whose current block was placed by a player during the match.
-    // Only these are breakable by default in a templated match.
-    std::unordered_set<BlockKey, BlockKeyHash> player_placed_{};
+    // Runtime modifications (placed/broken blocks), non-default block states and
+    // player-placed flags on top of the template/procedural base terrain.
+    // In a templated match only player-placed blocks are breakable by default.
+    BlockOverrides overrides_{};
 
     mutable std::array<unsigned char, 512> perm_{};
     mutable bool perm_initialized_{false};
@@ -2,15 +2,18 @@
 
 // BedWars Physics Utilities
 // Collision detection and resolution helpers for player vs voxel world.
+// Shared by the server (authoritative, against voxel::Terrain) and the client
+// (prediction, against voxel::World): the world type only needs
+// get_block(x, y, z) and get_block_state(x, y, z).
 
 #include <engine/modules/voxel/shared/block.hpp>
 #include <engine/modules/voxel/shared/block_state.hpp>
-#include "voxel/terrain.hpp"
 
+#include <array>
 #include <cmath>
 #include <cstdint>
 
-namespace bedwars::server::physics {
+namespace bedwars::physics {
 
 // ============================================================================
 // Constants
@@ -37,6 +40,89 @@ inline int fast_floor(float v) {
     return static_cast<int>(std::floor(v));
 }
 
+/// Block id as BlockType (the client world stores raw ids).
+template <typename World>
+inline shared::voxel::BlockType block_at(const World& terrain, int x, int y, int z) {
+    return static_cast<shared::voxel::BlockType>(terrain.get_block(x, y, z));
+}
+
+// ============================================================================
+// Local Block Cache
+// ============================================================================
+
+/// Block types and states around one player for the duration of a step.
+/// Each cell is read from the world on first use and memoized in a small
+/// stack array, so the X/Z/Y sweeps and step-up probes, which revisit the
+/// same cells, pay for each world lookup (override map + template) once.
+/// Cells outside the window fall through to the world unchanged. States are
+/// only meaningful for collision (see get_collision_boxes).
+template <typename World>
+class LocalBlockCache {
+public:
+    // Covers the player box plus one block of motion sideways, a fast fall
+    // below and a step-up above.
+    static constexpr int kSizeX = 4;
+    static constexpr int kSizeY = 8;
+    static constexpr int kSizeZ = 4;
+
+    LocalBlockCache(const World& world, float px, float py, float pz)
+        : world_(world)
+        , ox_(fast_floor(px) - 1)
+        , oy_(fast_floor(py) - 3)
+        , oz_(fast_floor(pz) - 1)
+    {
+    }
+
+    shared::voxel::BlockType get_block(int x, int y, int z) const {
+        const int i = index(x, y, z);
+        if (i < 0) return block_at(world_, x, y, z);
+        return fetch(i, x, y, z).type;
+    }
+
+    shared::voxel::BlockRuntimeState get_block_state(int x, int y, int z) const {
+        const int i = index(x, y, z);
+        if (i < 0) return world_.get_block_state(x, y, z);
+        return fetch(i, x, y, z).state;
+    }
+
+private:
+    static constexpr int kCells = kSizeX * kSizeY * kSizeZ;
+
+    struct Cell {
+        shared::voxel::BlockType type;
+        shared::voxel::BlockRuntimeState state;
+    };
+
+    int index(int x, int y, int z) const {
+        const auto lx = static_cast<unsigned>(x - ox_);
+        const auto ly = static_cast<unsigned>(y - oy_);
+        const auto lz = static_cast<unsigned>(z - oz_);
+        if (lx >= kSizeX || ly >= kSizeY || lz >= kSizeZ) return -1;
+        return static_cast<int>((ly * kSizeZ + lz) * kSizeX + lx);
+    }
+
+    const Cell& fetch(int i, int x, int y, int z) const {
+        const std::uint64_t bit = std::uint64_t{1} << (i & 63);
+        std::uint64_t& word = filled_[i >> 6];
+        if (!(word & bit)) {
+            // Only fences and slabs have state-dependent collision; skip the
+            // second world lookup for everything else.
+            const auto type = block_at(world_, x, y, z);
+            cells_[i].type = type;
+            cells_[i].state = (shared::voxel::is_fence(type) || shared::voxel::is_slab(type))
+                ? world_.get_block_state(x, y, z)
+                : shared::voxel::BlockRuntimeState::defaults();
+            word |= bit;
+        }
+        return cells_[i];
+    }
+
+    const World& world_;
+    int ox_, oy_, oz_;
+    mutable std::array<std::uint64_t, (kCells + 63) / 64> filled_{};
+    mutable std::array<Cell, kCells> cells_;
+};
+
 // ============================================================================
 // AABB Collision
 // ============================================================================
@@ -104,8 +190,9 @@ inline bool check_block_collision_3d_with_state(
 // ============================================================================
 
 /// Get the maximum step-up height at player's feet.
+template <typename World>
 inline float get_obstacle_step_height(
-    const ::bedwars::voxel::Terrain& terrain,
+    const World& terrain,
     float px, float py, float pz,
     float half_w, float half_d
 ) {
@@ -114,7 +201,7 @@ inline float get_obstacle_step_height(
     
     for (int bx = fast_floor(px - half_w + kEps); bx <= fast_floor(px + half_w - kEps); ++bx) {
         for (int bz = fast_floor(pz - half_d + kEps); bz <= fast_floor(pz + half_d - kEps); ++bz) {
-            auto block_type = terrain.get_block(bx, feet_y, bz);
+            auto block_type = block_at(terrain, bx, feet_y, bz);
             auto coll = shared::voxel::get_collision_info(block_type);
             if (!coll.hasCollision) continue;
             
@@ -138,8 +225,9 @@ inline float get_obstacle_step_height(
 }
 
 /// Try to step up over an obstacle. Returns true if step-up succeeded.
+template <typename World>
 inline bool try_step_up(
-    const ::bedwars::voxel::Terrain& terrain,
+    const World& terrain,
     float px, float& py, float pz,
     float half_w, float height, float half_d
 ) {
@@ -155,7 +243,7 @@ inline bool try_step_up(
     // Check headroom
     for (int bx = fast_floor(px - half_w + kEps); bx <= fast_floor(px + half_w - kEps); ++bx) {
         for (int bz = fast_floor(pz - half_d + kEps); bz <= fast_floor(pz + half_d - kEps); ++bz) {
-            auto block_type = terrain.get_block(bx, head_y, bz);
+            auto block_type = block_at(terrain, bx, head_y, bz);
             if (check_block_collision_3d(block_type, bx, head_y, bz, px, new_y, pz, half_w, height, half_d)) {
                 return false; // No headroom
             }
@@ -171,8 +259,9 @@ inline bool try_step_up(
 // ============================================================================
 
 /// Resolve X-axis collision. Modifies px and vx if collision found.
+template <typename World>
 inline void resolve_voxel_x(
-    const ::bedwars::voxel::Terrain& terrain,
+    const World& terrain,
     float& px, float py, float pz,
     float& vx, float dx
 ) {
@@ -192,7 +281,7 @@ inline void resolve_voxel_x(
         int check_x = fast_floor((px + half_w) - kEps);
         for (int by = min_y; by <= max_y; ++by) {
             for (int bz = min_z; bz <= max_z; ++bz) {
-                auto block_type = terrain.get_block(check_x, by, bz);
+                auto block_type = block_at(terrain, check_x, by, bz);
                 auto block_state = terrain.get_block_state(check_x, by, bz);
                 if (check_block_collision_3d_with_state(block_type, block_state, check_x, by, bz, 
                                                         px, py, pz, half_w, height, half_d)) {
@@ -215,7 +304,7 @@ inline void resolve_voxel_x(
         int check_x = fast_floor((px - half_w) + kEps);
         for (int by = min_y; by <= max_y; ++by) {
             for (int bz = min_z; bz <= max_z; ++bz) {
-                auto block_type = terrain.get_block(check_x, by, bz);
+                auto block_type = block_at(terrain, check_x, by, bz);
                 auto block_state = terrain.get_block_state(check_x, by, bz);
                 if (check_block_collision_3d_with_state(block_type, block_state, check_x, by, bz,
                                                         px, py, pz, half_w, height, half_d)) {
@@ -238,8 +327,9 @@ inline void resolve_voxel_x(
 }
 
 /// Resolve Z-axis collision. Modifies pz and vz if collision found.
+template <typename World>
 inline void resolve_voxel_z(
-    const ::bedwars::voxel::Terrain& terrain,
+    const World& terrain,
     float px, float py, float& pz,
     float& vz, float dz
 ) {
@@ -259,7 +349,7 @@ inline void resolve_voxel_z(
         int check_z = fast_floor((pz + half_d) - kEps);
         for (int by = min_y; by <= max_y; ++by) {
             for (int bx = min_x; bx <= max_x; ++bx) {
-                auto block_type = terrain.get_block(bx, by, check_z);
+                auto block_type = block_at(terrain, bx, by, check_z);
                 auto block_state = terrain.get_block_state(bx, by, check_z);
                 if (check_block_collision_3d_with_state(block_type, block_state, bx, by, check_z,
                                                         px, py, pz, half_w, height, half_d)) {
@@ -282,7 +372,7 @@ inline void resolve_voxel_z(
         int check_z = fast_floor((pz - half_d) + kEps);
         for (int by = min_y; by <= max_y; ++by) {
             for (int bx = min_x; bx <= max_x; ++bx) {
-                auto block_type = terrain.get_block(bx, by, check_z);
+                auto block_type = block_at(terrain, bx, by, check_z);
                 auto block_state = terrain.get_block_state(bx, by, check_z);
                 if (check_block_collision_3d_with_state(block_type, block_state, bx, by, check_z,
                                                         px, py, pz, half_w, height, half_d)) {
@@ -305,8 +395,9 @@ inline void resolve_voxel_z(
 }
 
 /// Resolve Y-axis collision. Modifies py, vy, and onGround.
+template <typename World>
 inline void resolve_voxel_y(
-    const ::bedwars::voxel::Terrain& terrain,
+    const World& terrain,
     float px, float& py, float pz,
     float& vy, float dy,
     bool& onGround
@@ -320,7 +411,7 @@ inline void resolve_voxel_y(
         for (int check_y = fast_floor(py - kEps); check_y >= fast_floor(py - 1.0f); --check_y) {
             for (int bx = fast_floor(px - half_w + kEps); bx <= fast_floor(px + half_w - kEps); ++bx) {
                 for (int bz = fast_floor(pz - half_d + kEps); bz <= fast_floor(pz + half_d - kEps); ++bz) {
-                    auto block_type = terrain.get_block(bx, check_y, bz);
+                    auto block_type = block_at(terrain, bx, check_y, bz);
                     auto block_state = terrain.get_block_state(bx, check_y, bz);
                     
                     shared::voxel::BlockCollisionInfo boxes[5];
@@ -369,7 +460,7 @@ inline void resolve_voxel_y(
         int check_y = fast_floor((py + height) - kEps);
         for (int bx = fast_floor(px - half_w + kEps); bx <= fast_floor(px + half_w - kEps); ++bx) {
             for (int bz = fast_floor(pz - half_d + kEps); bz <= fast_floor(pz + half_d - kEps); ++bz) {
-                auto block_type = terrain.get_block(bx, check_y, bz);
+                auto block_type = block_at(terrain, bx, check_y, bz);
                 auto block_state = terrain.get_block_state(bx, check_y, bz);
                 
                 shared::voxel::BlockCollisionInfo boxes[5];
@@ -416,9 +507,11 @@ inline void resolve_voxel_y(
 // Full Physics Simulation Step
 // ============================================================================
 
-/// Simulate one physics step with full collision resolution and step-up.
-inline void simulate_physics_step(
-    const ::bedwars::voxel::Terrain& terrain,
+/// Simulate one physics step with full collision resolution and step-up,
+/// reading the world directly. simulate_physics_step() is the cached form.
+template <typename World>
+inline void simulate_physics_step_uncached(
+    const World& terrain,
     float& px, float& py, float& pz,
     float& vx, float& vy, float& vz,
     bool& onGround, bool& lastJumpHeld,
@@ -511,4 +604,21 @@ inline void simulate_physics_step(
     }
 }
 
-} // namespace bedwars::server::physics
+/// Simulate one physics step with full collision resolution and step-up.
+/// Block lookups go through a LocalBlockCache built for this step.
+template <typename World>
+inline void simulate_physics_step(
+    const World& terrain,
+    float& px, float& py, float& pz,
+    float& vx, float& vy, float& vz,
+    bool& onGround, bool& lastJumpHeld,
+    float moveX, float moveY, float yaw,
+    bool jumpHeld, bool sprinting,
+    float dt
+) {
+    const LocalBlockCache<World> cache(terrain, px, py, pz);
+    simulate_physics_step_uncached(cache, px, py, pz, vx, vy, vz, onGround, lastJumpHeld,
+                                   moveX, moveY, yaw, jumpHeld, sprinting, dt);
+}
+
+} // namespace bedwars::physics
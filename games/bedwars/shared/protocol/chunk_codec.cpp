@@ -0,0 +1,197 @@
+#include "chunk_codec.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+
+namespace bedwars::proto::chunk_codec {
+
+namespace {
+
+// Section layout:
+//   u8  paletteSize - 1
+//   u8  palette[paletteSize]
+//   if paletteSize > 1:
+//     u8 mode: 0 = bit-packed indices (LSB first), 1 = runs of (u8 index, varint length)
+enum class SectionMode : std::uint8_t {
+    Packed = 0,
+    Runs = 1,
+};
+
+std::size_t varint_size(std::uint32_t v) {
+    std::size_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        ++n;
+    }
+    return n;
+}
+
+int bits_for_palette(std::size_t paletteSize) {
+    return static_cast<int>(std::bit_width(paletteSize - 1));
+}
+
+void encode_section(engine::ByteWriter& w, const std::uint8_t* cells) {
+    // Palette in first-seen order; indexOf maps block id -> palette slot.
+    std::array<std::int16_t, 256> indexOf;
+    indexOf.fill(-1);
+    std::array<std::uint8_t, 256> palette{};
+    std::size_t paletteSize = 0;
+    std::size_t runs = 0;
+    std::size_t runBytes = 0;
+
+    std::uint32_t runLength = 0;
+    for (int i = 0; i < kSectionVolume; ++i) {
+        const std::uint8_t v = cells[i];
+        if (indexOf[v] < 0) {
+            indexOf[v] = static_cast<std::int16_t>(paletteSize);
+            palette[paletteSize++] = v;
+        }
+        if (i > 0 && v != cells[i - 1]) {
+            ++runs;
+            runBytes += 1 + varint_size(runLength);
+            runLength = 0;
+        }
+        ++runLength;
+    }
+    ++runs;
+    runBytes += 1 + varint_size(runLength);
+
+    w.write_u8(static_cast<std::uint8_t>(paletteSize - 1));
+    w.write_bytes(std::span<const std::uint8_t>(palette.data(), paletteSize));
+    if (paletteSize == 1) return;
+
+    const int bits = bits_for_palette(paletteSize);
+    const std::size_t packedBytes = static_cast<std::size_t>(kSectionVolume) * static_cast<std::size_t>(bits) / 8;
+
+    if (runBytes < packedBytes) {
+        w.write_u8(static_cast<std::uint8_t>(SectionMode::Runs));
+        std::uint32_t length = 1;
+        for (int i = 1; i <= kSectionVolume; ++i) {
+            if (i < kSectionVolume && cells[i] == cells[i - 1]) {
+                ++length;
+                continue;
+            }
+            w.write_u8(static_cast<std::uint8_t>(indexOf[cells[i - 1]]));
+            w.write_varint(length);
+            length = 1;
+        }
+        return;
+    }
+
+    w.write_u8(static_cast<std::uint8_t>(SectionMode::Packed));
+    std::uint32_t acc = 0;
+    int accBits = 0;
+    for (int i = 0; i < kSectionVolume; ++i) {
+        acc |= static_cast<std::uint32_t>(indexOf[cells[i]]) << accBits;
+        accBits += bits;
+        while (accBits >= 8) {
+            w.write_u8(static_cast<std::uint8_t>(acc & 0xFF));
+            acc >>= 8;
+            accBits -= 8;
+        }
+    }
+    // 4096 * bits is always a multiple of 8, so nothing is left over.
+}
+
+void decode_section(engine::ByteReader& r, std::uint8_t* cells) {
+    const std::size_t paletteSize = static_cast<std::size_t>(r.read_u8()) + 1;
+    const auto palette = r.read_bytes(paletteSize);
+    if (paletteSize == 1) {
+        std::fill(cells, cells + kSectionVolume, palette[0]);
+        return;
+    }
+
+    const auto mode = static_cast<SectionMode>(r.read_u8());
+    if (mode == SectionMode::Runs) {
+        std::size_t pos = 0;
+        while (pos < static_cast<std::size_t>(kSectionVolume)) {
+            const std::uint8_t index = r.read_u8();
+            const std::uint32_t length = r.read_varint();
+            if (index >= paletteSize || length == 0 || length > kSectionVolume - pos) {
+                throw std::runtime_error("chunk_codec: bad run");
+            }
+            std::fill(cells + pos, cells + pos + length, palette[index]);
+            pos += length;
+        }
+        return;
+    }
+    if (mode != SectionMode::Packed) {
+        throw std::runtime_error("chunk_codec: unknown section mode");
+    }
+
+    const int bits = bits_for_palette(paletteSize);
+    const std::uint32_t mask = (1u << bits) - 1u;
+    const auto packed = r.read_bytes(static_cast<std::size_t>(kSectionVolume) * static_cast<std::size_t>(bits) / 8);
+    std::uint32_t acc = 0;
+    int accBits = 0;
+    std::size_t src = 0;
+    for (int i = 0; i < kSectionVolume; ++i) {
+        while (accBits < bits) {
+            acc |= static_cast<std::uint32_t>(packed[src++]) << accBits;
+            accBits += 8;
+        }
+        const std::uint32_t index = acc & mask;
+        acc >>= bits;
+        accBits -= bits;
+        if (index >= paletteSize) {
+            throw std::runtime_error("chunk_codec: palette index out of range");
+        }
+        cells[i] = palette[index];
+    }
+}
+
+} // namespace
+
+void encode(engine::ByteWriter& w, std::span<const std::uint8_t> blocks, std::uint8_t fillValue) {
+    if (blocks.size() != kChunkVolume) {
+        throw std::runtime_error("chunk_codec: chunk must have 65536 blocks");
+    }
+
+    std::uint16_t mask = 0;
+    for (int s = 0; s < kSectionCount; ++s) {
+        const auto* begin = blocks.data() + static_cast<std::size_t>(s) * kSectionVolume;
+        const bool uniformFill = std::all_of(begin, begin + kSectionVolume,
+                                             [fillValue](std::uint8_t v) { return v == fillValue; });
+        if (!uniformFill) {
+            mask = static_cast<std::uint16_t>(mask | (1u << s));
+        }
+    }
+
+    w.write_u16(mask);
+    for (int s = 0; s < kSectionCount; ++s) {
+        if (mask & (1u << s)) {
+            encode_section(w, blocks.data() + static_cast<std::size_t>(s) * kSectionVolume);
+        }
+    }
+}
+
+void decode(engine::ByteReader& r, std::uint8_t fillValue, std::vector<std::uint8_t>& out) {
+    out.assign(kChunkVolume, fillValue);
+    const std::uint16_t mask = r.read_u16();
+    for (int s = 0; s < kSectionCount; ++s) {
+        if (mask & (1u << s)) {
+            decode_section(r, out.data() + static_cast<std::size_t>(s) * kSectionVolume);
+        }
+    }
+}
+
+void make_delta(std::span<std::uint8_t> blocks, std::span<const std::uint8_t> base) {
+    const auto air = static_cast<std::uint8_t>(shared::voxel::BlockType::Air);
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        const std::uint8_t b = i < base.size() ? base[i] : air;
+        if (blocks[i] == b) blocks[i] = kKeepBlock;
+    }
+}
+
+void apply_delta(std::span<std::uint8_t> blocks, std::span<const std::uint8_t> base) {
+    const auto air = static_cast<std::uint8_t>(shared::voxel::BlockType::Air);
+    for (std::size_t i = 0; i < blocks.size(); ++i) {
+        if (blocks[i] == kKeepBlock) {
+            blocks[i] = i < base.size() ? base[i] : air;
+        }
+    }
+}
+
+} // namespace bedwars::proto::chunk_codec
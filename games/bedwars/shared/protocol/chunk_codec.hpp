@@ -0,0 +1,42 @@
+#pragma once
+
+// =============================================================================
+// Chunk codec - Compact wire encoding for ChunkData block arrays
+// Per 16-block vertical section: palette + bit-packed or run-length indices.
+// Sections that are entirely the fill value (Air, or "keep" for template
+// deltas) are skipped.
+// =============================================================================
+
+#include <engine/core/byte_buffer.hpp>
+#include <engine/modules/voxel/shared/block.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace bedwars::proto::chunk_codec {
+
+inline constexpr int kSectionHeight = 16;
+inline constexpr int kSectionVolume = shared::voxel::CHUNK_WIDTH * shared::voxel::CHUNK_DEPTH * kSectionHeight;
+inline constexpr int kSectionCount = shared::voxel::CHUNK_HEIGHT / kSectionHeight;
+inline constexpr std::size_t kChunkVolume = static_cast<std::size_t>(shared::voxel::CHUNK_SIZE);
+
+/// Marks a cell that equals the map template in a delta-encoded chunk.
+inline constexpr std::uint8_t kKeepBlock = 0xFF;
+
+/// Encode kChunkVolume block bytes (y * 256 + z * 16 + x order).
+/// Sections made only of fillValue are omitted from the stream.
+void encode(engine::ByteWriter& w, std::span<const std::uint8_t> blocks, std::uint8_t fillValue);
+
+/// Decode a stream written by encode() into out (resized to kChunkVolume).
+/// Throws std::runtime_error on malformed input, like ByteReader.
+void decode(engine::ByteReader& r, std::uint8_t fillValue, std::vector<std::uint8_t>& out);
+
+/// Replace every cell equal to base with kKeepBlock. base may be empty (all Air).
+void make_delta(std::span<std::uint8_t> blocks, std::span<const std::uint8_t> base);
+
+/// Resolve kKeepBlock cells from base. base may be empty (all Air).
+void apply_delta(std::span<std::uint8_t> blocks, std::span<const std::uint8_t> base);
+
+} // namespace bedwars::proto::chunk_codec
@@ -23,7 +23,7 @@ namespace bedwars::proto {
 // ============================================================================
 
 using ProtocolVersion = std::uint32_t;
-static constexpr ProtocolVersion kProtocolVersion = 1;  // Must match shared::proto for client compatibility
+static constexpr ProtocolVersion kProtocolVersion = 8;  // Must match shared::proto for client compatibility
 
 // ============================================================================
 // Re-export shared types for convenience
@@ -84,6 +84,18 @@ enum class MessageType : std::uint8_t {
     
     // Team selection (BW-1)
     SelectTeam = 25,
+    
+    // Late-join world sync (v3)
+    WorldDelta = 26,
+    
+    // Entity replication (v4)
+    EntitySnapshot = 27,
+    
+    // Item stacks (v7)
+    ItemCountChanged = 28,
+    
+    // Combat (v8)
+    TryAttack = 29,
 };
 
 // ============================================================================
@@ -124,7 +136,11 @@ struct ServerHello {
     std::vector<TeamId> availableTeams;
 };
 
-struct JoinMatch {};
+struct JoinMatch {
+    // Client loaded the template advertised in ServerHello, so chunk data may be
+    // sent as a delta against it (v2)
+    bool hasMapTemplate{false};
+};
 
 struct JoinAck {
     engine::PlayerId playerId{0};
@@ -146,6 +162,9 @@ struct InputFrame {
     // Editor camera mode
     bool camUp{false};
     bool camDown{false};
+    
+    // Newest EntitySnapshot the client decoded; baseline for the next delta (v4)
+    engine::Tick ackSnapshotTick{0};
 };
 
 // ============================================================================
@@ -153,6 +172,10 @@ struct InputFrame {
 // ============================================================================
 
 struct StateSnapshot {
+    // flags
+    static constexpr std::uint8_t kFlagOnGround = 1 << 0;
+    static constexpr std::uint8_t kFlagJumpHeld = 1 << 1;  // Jump edge detection state
+    
     engine::Tick serverTick{0};
     engine::PlayerId playerId{0};
     float px{0.0f};
@@ -161,12 +184,53 @@ struct StateSnapshot {
     float vx{0.0f};
     float vy{0.0f};
     float vz{0.0f};
+    
+    // Newest InputFrame::seq the server has simulated for this player (0 = none yet) (v5)
+    std::uint32_t lastInputSeq{0};
+    
+    // Physics state the client needs to replay inputs from this snapshot (v6)
+    std::uint8_t flags{0};
+};
+
+// Other players near the receiver, quantized and delta-encoded against the
+// last snapshot the client acknowledged. Sent unreliably every tick; see
+// snapshot_codec.hpp for building and applying it.
+struct EntitySnapshot {
+    // Entity::fields
+    static constexpr std::uint8_t kPosition = 1 << 0;       // x/y/z absolute
+    static constexpr std::uint8_t kPositionDelta = 1 << 1;  // x/y/z relative to baseline
+    static constexpr std::uint8_t kRotation = 1 << 2;
+    static constexpr std::uint8_t kState = 1 << 3;          // team + flags
+    
+    // Entity::flags
+    static constexpr std::uint8_t kFlagAlive = 1 << 0;
+    static constexpr std::uint8_t kFlagOnGround = 1 << 1;
+    
+    struct Entity {
+        engine::PlayerId id{0};
+        std::uint8_t fields{0};
+        std::int32_t x{0};  // 1/64 block units (snapshot_codec::kPositionScale)
+        std::int32_t y{0};
+        std::int32_t z{0};
+        std::uint16_t yaw{0};
+        std::uint16_t pitch{0};
+        TeamId team{Teams::None};
+        std::uint8_t flags{0};
+    };
+    
+    engine::Tick serverTick{0};
+    engine::Tick baselineTick{0};               // 0 = full snapshot
+    std::vector<engine::PlayerId> removed;      // In baseline, no longer visible
+    std::vector<Entity> entities;               // New or changed since baseline
 };
 
 struct ChunkData {
     std::int32_t chunkX{0};
     std::int32_t chunkZ{0};
+    // Blocks hold chunk_codec::kKeepBlock where the cell equals the map template (v2)
+    bool deltaFromTemplate{false};
     // Flat array of blocks: [y][z][x] order, 16x256x16 = 65536 blocks
+    // On the wire: palette/RLE sections, see chunk_codec.hpp
     std::vector<std::uint8_t> blocks;
 };
 
@@ -220,6 +284,23 @@ struct ActionRejected {
     RejectReason reason{RejectReason::Unknown};
 };
 
+// Batched world modifications for late joiners, grouped per chunk column.
+// A join sync is split into several WorldDelta packets; the last has final=true.
+struct WorldDelta {
+    struct Block {
+        std::uint16_t localIndex{0};  // y * 256 + z * 16 + x within the chunk
+        BlockType blockType{BlockType::Air};
+        std::uint8_t stateByte{0};
+    };
+    struct Chunk {
+        std::int32_t chunkX{0};
+        std::int32_t chunkZ{0};
+        std::vector<Block> blocks;  // Ascending localIndex (delta-coded on the wire)
+    };
+    std::vector<Chunk> chunks;
+    bool final{false};
+};
+
 // ============================================================================
 // Messages - Map Export (Editor)
 // ============================================================================
@@ -296,6 +377,20 @@ struct SelectTeam {
     TeamId teamId{Teams::None};
 };
 
+// ============================================================================
+// Messages - Combat
+// ============================================================================
+
+// Melee swing at another player (v8). The server rewinds the target to the
+// client's view time before checking the aim ray against its hitbox.
+struct TryAttack {
+    std::uint32_t seq{0};
+    engine::PlayerId targetId{0};
+    engine::Tick viewTick{0};   // Newest EntitySnapshot tick the client had applied
+    float yaw{0.0f};
+    float pitch{0.0f};
+};
+
 // ============================================================================
 // Messages - Items
 // ============================================================================
@@ -314,6 +409,12 @@ struct ItemPickedUp {
     engine::PlayerId playerId{0};
 };
 
+// A generator drop merged into an existing stack (v7)
+struct ItemCountChanged {
+    std::uint32_t entityId{0};
+    std::uint16_t count{0};
+};
+
 struct InventoryUpdate {
     engine::PlayerId playerId{0};
     ItemType itemType{ItemType::None};
@@ -335,6 +436,7 @@ using Message = std::variant<
     InputFrame,
     // State
     StateSnapshot,
+    EntitySnapshot,
     ChunkData,
     // Blocks
     TryPlaceBlock,
@@ -343,6 +445,7 @@ using Message = std::variant<
     BlockPlaced,
     BlockBroken,
     ActionRejected,
+    WorldDelta,
     // Map export
     TryExportMap,
     ExportResult,
@@ -357,9 +460,12 @@ using Message = std::variant<
     // Items
     ItemSpawned,
     ItemPickedUp,
+    ItemCountChanged,
     InventoryUpdate,
     // BW-1
-    SelectTeam
+    SelectTeam,
+    // Combat
+    TryAttack
 >;
 
 } // namespace bedwars::proto
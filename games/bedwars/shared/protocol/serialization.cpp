@@ -1,14 +1,26 @@
 #include "serialization.hpp"
+#include "chunk_codec.hpp"
 
 namespace bedwars::proto {
 
+namespace {
+
+// Zigzag keeps small negative deltas small as varints
+std::uint32_t zigzag(std::int32_t v) {
+    return (static_cast<std::uint32_t>(v) << 1) ^ static_cast<std::uint32_t>(v >> 31);
+}
+
+std::int32_t unzigzag(std::uint32_t v) {
+    return static_cast<std::int32_t>(v >> 1) ^ -static_cast<std::int32_t>(v & 1);
+}
+
+} // namespace
+
 // ============================================================================
 // Serialize
 // ============================================================================
 
-std::vector<std::uint8_t> serialize(const Message& msg) {
-    engine::ByteWriter w;
-    
+void serialize_into(const Message& msg, engine::ByteWriter& w) {
     std::visit([&w](const auto& m) {
         using T = std::decay_t<decltype(m)>;
         
@@ -34,6 +46,7 @@ std::vector<std::uint8_t> serialize(const Message& msg) {
         }
         else if constexpr (std::is_same_v<T, JoinMatch>) {
             w.write_u8(static_cast<std::uint8_t>(MessageType::JoinMatch));
+            w.write_bool(m.hasMapTemplate);
         }
         else if constexpr (std::is_same_v<T, JoinAck>) {
             w.write_u8(static_cast<std::uint8_t>(MessageType::JoinAck));
@@ -51,6 +64,7 @@ std::vector<std::uint8_t> serialize(const Message& msg) {
             w.write_bool(m.sprint);
             w.write_bool(m.camUp);
             w.write_bool(m.camDown);
+            w.write_u64(m.ackSnapshotTick);
         }
         // --- State ---
         else if constexpr (std::is_same_v<T, StateSnapshot>) {
@@ -63,15 +77,49 @@ std::vector<std::uint8_t> serialize(const Message& msg) {
             w.write_f32(m.vx);
             w.write_f32(m.vy);
             w.write_f32(m.vz);
+            w.write_u32(m.lastInputSeq);
+            w.write_u8(m.flags);
+        }
+        else if constexpr (std::is_same_v<T, EntitySnapshot>) {
+            w.write_u8(static_cast<std::uint8_t>(MessageType::EntitySnapshot));
+            w.write_u64(m.serverTick);
+            // Baseline as a distance back from serverTick (0 = full snapshot)
+            const engine::Tick back = m.baselineTick != 0 ? m.serverTick - m.baselineTick : 0;
+            w.write_varint(static_cast<std::uint32_t>(back));
+            w.write_varint(static_cast<std::uint32_t>(m.removed.size()));
+            for (auto id : m.removed) {
+                w.write_varint(id);
+            }
+            w.write_varint(static_cast<std::uint32_t>(m.entities.size()));
+            for (const auto& e : m.entities) {
+                w.write_varint(e.id);
+                w.write_u8(e.fields);
+                if (e.fields & EntitySnapshot::kPosition) {
+                    w.write_i32(e.x);
+                    w.write_i32(e.y);
+                    w.write_i32(e.z);
+                } else if (e.fields & EntitySnapshot::kPositionDelta) {
+                    w.write_varint(zigzag(e.x));
+                    w.write_varint(zigzag(e.y));
+                    w.write_varint(zigzag(e.z));
+                }
+                if (e.fields & EntitySnapshot::kRotation) {
+                    w.write_u16(e.yaw);
+                    w.write_u16(e.pitch);
+                }
+                if (e.fields & EntitySnapshot::kState) {
+                    w.write_u8(e.team);
+                    w.write_u8(e.flags);
+                }
+            }
         }
         else if constexpr (std::is_same_v<T, ChunkData>) {
             w.write_u8(static_cast<std::uint8_t>(MessageType::ChunkData));
             w.write_i32(m.chunkX);
             w.write_i32(m.chunkZ);
-            w.write_u32(static_cast<std::uint32_t>(m.blocks.size()));
-            for (auto b : m.blocks) {
-                w.write_u8(b);
-            }
+            w.write_bool(m.deltaFromTemplate);
+            chunk_codec::encode(w, m.blocks, m.deltaFromTemplate ? chunk_codec::kKeepBlock
+                                                                 : static_cast<std::uint8_t>(BlockType::Air));
         }
         // --- Blocks ---
         else if constexpr (std::is_same_v<T, TryPlaceBlock>) {
@@ -120,6 +168,23 @@ std::vector<std::uint8_t> serialize(const Message& msg) {
             w.write_u32(m.seq);
             w.write_u8(static_cast<std::uint8_t>(m.reason));
         }
+        else if constexpr (std::is_same_v<T, WorldDelta>) {
+            w.write_u8(static_cast<std::uint8_t>(MessageType::WorldDelta));
+            w.write_bool(m.final);
+            w.write_varint(static_cast<std::uint32_t>(m.chunks.size()));
+            for (const auto& chunk : m.chunks) {
+                w.write_i32(chunk.chunkX);
+                w.write_i32(chunk.chunkZ);
+                w.write_varint(static_cast<std::uint32_t>(chunk.blocks.size()));
+                std::uint32_t prev = 0;
+                for (const auto& b : chunk.blocks) {
+                    w.write_varint(b.localIndex - prev);
+                    w.write_u8(static_cast<std::uint8_t>(b.blockType));
+                    w.write_u8(b.stateByte);
+                    prev = b.localIndex;
+                }
+            }
+        }
         // --- Map Export ---
         else if constexpr (std::is_same_v<T, TryExportMap>) {
             w.write_u8(static_cast<std::uint8_t>(MessageType::TryExportMap));
@@ -198,6 +263,11 @@ std::vector<std::uint8_t> serialize(const Message& msg) {
             w.write_u32(m.entityId);
             w.write_u32(m.playerId);
         }
+        else if constexpr (std::is_same_v<T, ItemCountChanged>) {
+            w.write_u8(static_cast<std::uint8_t>(MessageType::ItemCountChanged));
+            w.write_u32(m.entityId);
+            w.write_u16(m.count);
+        }
         else if constexpr (std::is_same_v<T, InventoryUpdate>) {
             w.write_u8(static_cast<std::uint8_t>(MessageType::InventoryUpdate));
             w.write_u32(m.playerId);
@@ -210,11 +280,32 @@ std::vector<std::uint8_t> serialize(const Message& msg) {
             w.write_u8(static_cast<std::uint8_t>(MessageType::SelectTeam));
             w.write_u8(m.teamId);
         }
+        // --- Combat ---
+        else if constexpr (std::is_same_v<T, TryAttack>) {
+            w.write_u8(static_cast<std::uint8_t>(MessageType::TryAttack));
+            w.write_u32(m.seq);
+            w.write_u32(m.targetId);
+            w.write_u64(m.viewTick);
+            w.write_f32(m.yaw);
+            w.write_f32(m.pitch);
+        }
     }, msg);
-    
+}
+
+std::vector<std::uint8_t> serialize(const Message& msg) {
+    engine::ByteWriter w;
+    serialize_into(msg, w);
     return w.take();
 }
 
+engine::PacketRef serialize_packet(const Message& msg) {
+    auto packet = engine::PacketPool::instance().acquire();
+    engine::ByteWriter w(std::move(packet.bytes()));
+    serialize_into(msg, w);
+    packet.bytes() = w.take();
+    return packet;
+}
+
 // ============================================================================
 // Deserialize
 // ============================================================================
@@ -253,7 +344,9 @@ std::optional<Message> deserialize(std::span<const std::uint8_t> data) {
                 return m;
             }
             case MessageType::JoinMatch: {
-                return JoinMatch{};
+                JoinMatch m;
+                m.hasMapTemplate = r.read_bool();
+                return m;
             }
             case MessageType::JoinAck: {
                 JoinAck m;
@@ -272,6 +365,7 @@ std::optional<Message> deserialize(std::span<const std::uint8_t> data) {
                 m.sprint = r.read_bool();
                 m.camUp = r.read_bool();
                 m.camDown = r.read_bool();
+                m.ackSnapshotTick = r.read_u64();
                 return m;
             }
             // --- State ---
@@ -285,17 +379,57 @@ std::optional<Message> deserialize(std::span<const std::uint8_t> data) {
                 m.vx = r.read_f32();
                 m.vy = r.read_f32();
                 m.vz = r.read_f32();
+                m.lastInputSeq = r.read_u32();
+                m.flags = r.read_u8();
+                return m;
+            }
+            case MessageType::EntitySnapshot: {
+                EntitySnapshot m;
+                m.serverTick = r.read_u64();
+                const std::uint32_t back = r.read_varint();
+                if (back > m.serverTick) return std::nullopt;
+                m.baselineTick = back != 0 ? m.serverTick - back : 0;
+                const std::uint32_t removedCount = r.read_varint();
+                if (removedCount > r.remaining()) return std::nullopt;
+                m.removed.resize(removedCount);
+                for (auto& id : m.removed) {
+                    id = r.read_varint();
+                }
+                const std::uint32_t entityCount = r.read_varint();
+                // Each entity needs at least an id and a field mask
+                if (entityCount > r.remaining() / 2) return std::nullopt;
+                m.entities.resize(entityCount);
+                for (auto& e : m.entities) {
+                    e.id = r.read_varint();
+                    e.fields = r.read_u8();
+                    if (e.fields & EntitySnapshot::kPosition) {
+                        e.x = r.read_i32();
+                        e.y = r.read_i32();
+                        e.z = r.read_i32();
+                    } else if (e.fields & EntitySnapshot::kPositionDelta) {
+                        e.x = unzigzag(r.read_varint());
+                        e.y = unzigzag(r.read_varint());
+                        e.z = unzigzag(r.read_varint());
+                    }
+                    if (e.fields & EntitySnapshot::kRotation) {
+                        e.yaw = r.read_u16();
+                        e.pitch = r.read_u16();
+                    }
+                    if (e.fields & EntitySnapshot::kState) {
+                        e.team = r.read_u8();
+                        e.flags = r.read_u8();
+                    }
+                }
                 return m;
             }
             case MessageType::ChunkData: {
                 ChunkData m;
                 m.chunkX = r.read_i32();
                 m.chunkZ = r.read_i32();
-                std::uint32_t size = r.read_u32();
-                m.blocks.resize(size);
-                for (std::uint32_t i = 0; i < size; ++i) {
-                    m.blocks[i] = r.read_u8();
-                }
+                m.deltaFromTemplate = r.read_bool();
+                chunk_codec::decode(r, m.deltaFromTemplate ? chunk_codec::kKeepBlock
+                                                           : static_cast<std::uint8_t>(BlockType::Air),
+                                    m.blocks);
                 return m;
             }
             // --- Blocks ---
@@ -351,6 +485,30 @@ std::optional<Message> deserialize(std::span<const std::uint8_t> data) {
                 m.reason = static_cast<RejectReason>(r.read_u8());
                 return m;
             }
+            case MessageType::WorldDelta: {
+                WorldDelta m;
+                m.final = r.read_bool();
+                const std::uint32_t chunkCount = r.read_varint();
+                // Each chunk needs at least 9 bytes; reject counts the packet can't hold
+                if (chunkCount > r.remaining() / 9) return std::nullopt;
+                m.chunks.resize(chunkCount);
+                for (auto& chunk : m.chunks) {
+                    chunk.chunkX = r.read_i32();
+                    chunk.chunkZ = r.read_i32();
+                    const std::uint32_t blockCount = r.read_varint();
+                    if (blockCount > r.remaining() / 3) return std::nullopt;
+                    chunk.blocks.resize(blockCount);
+                    std::uint32_t index = 0;
+                    for (auto& b : chunk.blocks) {
+                        index += r.read_varint();
+                        if (index > 0xFFFF) return std::nullopt;
+                        b.localIndex = static_cast<std::uint16_t>(index);
+                        b.blockType = static_cast<BlockType>(r.read_u8());
+                        b.stateByte = r.read_u8();
+                    }
+                }
+                return m;
+            }
             // --- Map Export ---
             case MessageType::TryExportMap: {
                 TryExportMap m;
@@ -440,6 +598,12 @@ std::optional<Message> deserialize(std::span<const std::uint8_t> data) {
                 m.playerId = r.read_u32();
                 return m;
             }
+            case MessageType::ItemCountChanged: {
+                ItemCountChanged m;
+                m.entityId = r.read_u32();
+                m.count = r.read_u16();
+                return m;
+            }
             case MessageType::InventoryUpdate: {
                 InventoryUpdate m;
                 m.playerId = r.read_u32();
@@ -454,6 +618,16 @@ std::optional<Message> deserialize(std::span<const std::uint8_t> data) {
                 m.teamId = r.read_u8();
                 return m;
             }
+            // --- Combat ---
+            case MessageType::TryAttack: {
+                TryAttack m;
+                m.seq = r.read_u32();
+                m.targetId = r.read_u32();
+                m.viewTick = r.read_u64();
+                m.yaw = r.read_f32();
+                m.pitch = r.read_f32();
+                return m;
+            }
             default:
                 return std::nullopt;
         }
@@ -2,6 +2,7 @@
 
 #include "messages.hpp"
 #include <engine/core/byte_buffer.hpp>
+#include <engine/core/packet_pool.hpp>
 
 #include <optional>
 #include <vector>
@@ -15,6 +16,12 @@ namespace bedwars::proto {
 /// Serialize a message to bytes.
 std::vector<std::uint8_t> serialize(const Message& msg);
 
+/// Append a message to w.
+void serialize_into(const Message& msg, engine::ByteWriter& w);
+
+/// Serialize into a pooled packet buffer; no allocation once the pool is warm.
+engine::PacketRef serialize_packet(const Message& msg);
+
 /// Deserialize bytes to a message.
 /// Returns std::nullopt if parsing fails.
 std::optional<Message> deserialize(std::span<const std::uint8_t> data);
@@ -0,0 +1,144 @@
+#include "snapshot_codec.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace bedwars::proto::snapshot_codec {
+
+namespace {
+
+constexpr std::uint8_t kFullFields = EntitySnapshot::kPosition | EntitySnapshot::kRotation | EntitySnapshot::kState;
+
+bool id_less(const EntityState& e, engine::PlayerId id) {
+    return e.id < id;
+}
+
+} // namespace
+
+// ============================================================================
+// Quantization
+// ============================================================================
+
+std::int32_t quantize_position(float v) {
+    return static_cast<std::int32_t>(std::lround(v * kPositionScale));
+}
+
+float dequantize_position(std::int32_t q) {
+    return static_cast<float>(q) / kPositionScale;
+}
+
+std::uint16_t quantize_yaw(float degrees) {
+    float wrapped = std::fmod(degrees, 360.0f);
+    if (wrapped < 0.0f) wrapped += 360.0f;
+    return static_cast<std::uint16_t>(std::lround(wrapped * (65536.0f / 360.0f)) & 0xFFFF);
+}
+
+float dequantize_yaw(std::uint16_t q) {
+    return static_cast<float>(q) * (360.0f / 65536.0f);
+}
+
+std::uint16_t quantize_pitch(float degrees) {
+    const float clamped = std::clamp(degrees, -90.0f, 90.0f);
+    return static_cast<std::uint16_t>(std::lround((clamped + 90.0f) * (65535.0f / 180.0f)));
+}
+
+float dequantize_pitch(std::uint16_t q) {
+    return static_cast<float>(q) * (180.0f / 65535.0f) - 90.0f;
+}
+
+// ============================================================================
+// Delta building / resolution
+// ============================================================================
+
+void build_delta(const EntityList& current, const EntityList* baseline, EntitySnapshot& out) {
+    out.removed.clear();
+    out.entities.clear();
+
+    static const EntityList kEmpty;
+    const EntityList& base = baseline ? *baseline : kEmpty;
+
+    // Both lists are sorted by id: merge them.
+    std::size_t i = 0;
+    std::size_t j = 0;
+    while (i < current.size() || j < base.size()) {
+        if (j == base.size() || (i < current.size() && current[i].id < base[j].id)) {
+            const auto& c = current[i++];
+            out.entities.push_back({c.id, kFullFields, c.x, c.y, c.z, c.yaw, c.pitch, c.team, c.flags});
+            continue;
+        }
+        if (i == current.size() || base[j].id < current[i].id) {
+            out.removed.push_back(base[j++].id);
+            continue;
+        }
+
+        const auto& c = current[i++];
+        const auto& b = base[j++];
+        EntitySnapshot::Entity e{};
+        e.id = c.id;
+        if (c.x != b.x || c.y != b.y || c.z != b.z) {
+            e.fields |= EntitySnapshot::kPositionDelta;
+            e.x = c.x - b.x;
+            e.y = c.y - b.y;
+            e.z = c.z - b.z;
+        }
+        if (c.yaw != b.yaw || c.pitch != b.pitch) {
+            e.fields |= EntitySnapshot::kRotation;
+            e.yaw = c.yaw;
+            e.pitch = c.pitch;
+        }
+        if (c.team != b.team || c.flags != b.flags) {
+            e.fields |= EntitySnapshot::kState;
+            e.team = c.team;
+            e.flags = c.flags;
+        }
+        if (e.fields != 0) {
+            out.entities.push_back(e);
+        }
+    }
+}
+
+bool apply_delta(const EntitySnapshot& msg, const EntityList* baseline, EntityList& out) {
+    if (msg.baselineTick != 0 && !baseline) return false;
+
+    out.clear();
+    if (baseline) {
+        out = *baseline;
+    }
+
+    for (auto id : msg.removed) {
+        auto it = std::lower_bound(out.begin(), out.end(), id, id_less);
+        if (it != out.end() && it->id == id) {
+            out.erase(it);
+        }
+    }
+
+    for (const auto& e : msg.entities) {
+        auto it = std::lower_bound(out.begin(), out.end(), e.id, id_less);
+        if (it == out.end() || it->id != e.id) {
+            // New entities must carry their full state.
+            if ((e.fields & kFullFields) != kFullFields) return false;
+            it = out.insert(it, EntityState{e.id});
+        }
+
+        if (e.fields & EntitySnapshot::kPosition) {
+            it->x = e.x;
+            it->y = e.y;
+            it->z = e.z;
+        } else if (e.fields & EntitySnapshot::kPositionDelta) {
+            it->x += e.x;
+            it->y += e.y;
+            it->z += e.z;
+        }
+        if (e.fields & EntitySnapshot::kRotation) {
+            it->yaw = e.yaw;
+            it->pitch = e.pitch;
+        }
+        if (e.fields & EntitySnapshot::kState) {
+            it->team = e.team;
+            it->flags = e.flags;
+        }
+    }
+    return true;
+}
+
+} // namespace bedwars::proto::snapshot_codec
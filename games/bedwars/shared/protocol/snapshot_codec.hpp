@@ -0,0 +1,91 @@
+#pragma once
+
+// =============================================================================
+// Snapshot codec - Quantized entity state and EntitySnapshot delta building
+// The server and the client each keep a short History of the entity sets they
+// sent/decoded, keyed by server tick. A delta is built against the newest
+// snapshot the client acknowledged and resolved against the same entry.
+// =============================================================================
+
+#include "messages.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace bedwars::proto::snapshot_codec {
+
+/// Position units per block (1/64 block precision).
+inline constexpr float kPositionScale = 64.0f;
+
+/// Full quantized state of one replicated entity.
+struct EntityState {
+    engine::PlayerId id{0};
+    std::int32_t x{0};
+    std::int32_t y{0};
+    std::int32_t z{0};
+    std::uint16_t yaw{0};
+    std::uint16_t pitch{0};
+    TeamId team{Teams::None};
+    std::uint8_t flags{0};  // EntitySnapshot::kFlag*
+};
+
+/// Entity list sorted by id.
+using EntityList = std::vector<EntityState>;
+
+std::int32_t quantize_position(float v);
+float dequantize_position(std::int32_t q);
+
+/// Yaw in degrees, any range (wrapped to [0, 360)).
+std::uint16_t quantize_yaw(float degrees);
+float dequantize_yaw(std::uint16_t q);
+
+/// Pitch in degrees, clamped to [-90, 90].
+std::uint16_t quantize_pitch(float degrees);
+float dequantize_pitch(std::uint16_t q);
+
+/// Ring of recent entity lists keyed by server tick.
+class History {
+public:
+    static constexpr std::size_t kSize = 32;
+
+    /// Entities stored for tick, or nullptr if it was never stored or has been overwritten.
+    const EntityList* find(engine::Tick tick) const {
+        if (tick == 0) return nullptr;
+        const auto& frame = frames_[tick % kSize];
+        return frame.tick == tick ? &frame.entities : nullptr;
+    }
+
+    /// Slot for tick (cleared). Overwrites the entry kSize ticks older.
+    EntityList& store(engine::Tick tick) {
+        auto& frame = frames_[tick % kSize];
+        frame.tick = tick;
+        frame.entities.clear();
+        return frame.entities;
+    }
+
+    void clear() {
+        for (auto& frame : frames_) {
+            frame.tick = 0;
+            frame.entities.clear();
+        }
+    }
+
+private:
+    struct Frame {
+        engine::Tick tick{0};
+        EntityList entities;
+    };
+    std::array<Frame, kSize> frames_{};
+};
+
+/// Fill out.removed/out.entities with the difference from baseline to current.
+/// baseline may be null (full snapshot). Tick fields are left to the caller.
+void build_delta(const EntityList& current, const EntityList* baseline, EntitySnapshot& out);
+
+/// Resolve msg against baseline into out (sorted by id). Returns false if
+/// msg is a delta and baseline is null, or it references unknown entities.
+bool apply_delta(const EntitySnapshot& msg, const EntityList* baseline, EntityList& out);
+
+} // namespace bedwars::proto::snapshot_codec
@@ -0,0 +1,158 @@
+// =============================================================================
+// ChunkData codec benchmark
+// Measures wire size and encode/decode time of the palette/RLE chunk codec on
+// real .rfmap templates, both as full chunks and as deltas against the
+// template after simulated match edits.
+//
+// Usage: bedwars_chunk_codec_bench [map.rfmap ...]
+//        (no arguments: every .rfmap in the runtime maps directory, or
+//         procedural terrain if there are none)
+// =============================================================================
+
+#include "shared/protocol/chunk_codec.hpp"
+#include "server/voxel/terrain.hpp"
+
+#include <engine/maps/rfmap_io.hpp>
+#include <engine/maps/runtime_paths.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+namespace codec = bedwars::proto::chunk_codec;
+using Clock = std::chrono::steady_clock;
+
+struct Totals {
+    std::size_t chunks{0};
+    std::size_t rawBytes{0};
+    std::size_t fullBytes{0};
+    std::size_t deltaBytes{0};
+    double encodeUs{0.0};
+    double decodeUs{0.0};
+};
+
+double us_since(Clock::time_point t0) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+}
+
+void measure_chunk(const std::vector<std::uint8_t>& blocks, std::span<const std::uint8_t> base, Totals& t) {
+    const auto air = static_cast<std::uint8_t>(shared::voxel::BlockType::Air);
+
+    engine::ByteWriter full;
+    const auto t0 = Clock::now();
+    codec::encode(full, blocks, air);
+    t.encodeUs += us_since(t0);
+
+    std::vector<std::uint8_t> decoded;
+    engine::ByteReader reader(full.data());
+    const auto t1 = Clock::now();
+    codec::decode(reader, air, decoded);
+    t.decodeUs += us_since(t1);
+    if (decoded != blocks) {
+        std::fprintf(stderr, "round-trip mismatch\n");
+    }
+
+    std::vector<std::uint8_t> delta = blocks;
+    codec::make_delta(delta, base);
+    engine::ByteWriter deltaOut;
+    codec::encode(deltaOut, delta, codec::kKeepBlock);
+
+    ++t.chunks;
+    t.rawBytes += blocks.size();
+    t.fullBytes += full.data().size();
+    t.deltaBytes += deltaOut.data().size();
+}
+
+void print_totals(const std::string& label, const Totals& t) {
+    if (t.chunks == 0) return;
+    std::printf("%-28s %5zu chunks  raw %8.1f KiB  full %7.1f KiB (%5.1fx)  delta %6.1f KiB  "
+                "enc %6.1f us  dec %6.1f us /chunk\n",
+                label.c_str(), t.chunks,
+                static_cast<double>(t.rawBytes) / 1024.0,
+                static_cast<double>(t.fullBytes) / 1024.0,
+                static_cast<double>(t.rawBytes) / static_cast<double>(t.fullBytes),
+                static_cast<double>(t.deltaBytes) / 1024.0,
+                t.encodeUs / static_cast<double>(t.chunks),
+                t.decodeUs / static_cast<double>(t.chunks));
+}
+
+// Scatter player-style edits (bridges, broken blocks) over the map.
+void simulate_edits(bedwars::voxel::Terrain& terrain, const shared::maps::ChunkBounds& b, std::size_t count) {
+    std::mt19937 rng(1337);
+    std::uniform_int_distribution<int> xs(b.chunkMinX * 16, b.chunkMaxX * 16 + 15);
+    std::uniform_int_distribution<int> zs(b.chunkMinZ * 16, b.chunkMaxZ * 16 + 15);
+    std::uniform_int_distribution<int> ys(40, 100);
+    for (std::size_t i = 0; i < count; ++i) {
+        terrain.place_player_block(xs(rng), ys(rng), zs(rng), shared::voxel::BlockType::TeamRed);
+    }
+}
+
+void bench_map(const std::filesystem::path& path) {
+    std::string err;
+    auto map = shared::maps::read_rfmap_shared(path, &err);
+    if (!map) {
+        std::fprintf(stderr, "%s: %s\n", path.string().c_str(), err.c_str());
+        return;
+    }
+
+    bedwars::voxel::Terrain terrain(0);
+    terrain.set_map_template(map);
+    simulate_edits(terrain, map->bounds, 2000);
+
+    Totals t;
+    const auto& b = map->bounds;
+    for (int cz = b.chunkMinZ; cz <= b.chunkMaxZ; ++cz) {
+        for (int cx = b.chunkMinX; cx <= b.chunkMaxX; ++cx) {
+            const auto blocks = terrain.get_chunk_data(cx, cz);
+            std::span<const std::uint8_t> base;
+            if (const auto* chunk = map->find_chunk(cx, cz)) {
+                base = {reinterpret_cast<const std::uint8_t*>(chunk->blocks.data()), chunk->blocks.size()};
+            }
+            measure_chunk(blocks, base, t);
+        }
+    }
+    print_totals(path.filename().string(), t);
+}
+
+void bench_procedural() {
+    bedwars::voxel::Terrain terrain(12345);
+    Totals t;
+    for (int cz = -6; cz < 6; ++cz) {
+        for (int cx = -6; cx < 6; ++cx) {
+            measure_chunk(terrain.get_chunk_data(cx, cz), {}, t);
+        }
+    }
+    print_totals("procedural (seed 12345)", t);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::filesystem::path> maps;
+    for (int i = 1; i < argc; ++i) {
+        maps.emplace_back(argv[i]);
+    }
+
+    if (maps.empty()) {
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator(shared::maps::runtime_maps_dir(), ec)) {
+            if (entry.path().extension() == ".rfmap") maps.push_back(entry.path());
+        }
+    }
+
+    if (maps.empty()) {
+        std::printf("No .rfmap files found, benchmarking procedural terrain\n");
+        bench_procedural();
+        return 0;
+    }
+
+    for (const auto& path : maps) {
+        bench_map(path);
+    }
+    return 0;
+}
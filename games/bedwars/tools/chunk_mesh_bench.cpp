@@ -0,0 +1,528 @@
+// =============================================================================
+// Chunk meshing benchmark
+// Builds a grid of chunk section snapshots on the calling thread and then
+// through ChunkMeshWorkers, and checks that every worker-built mesh (reusing
+// recycled buffers across rounds) matches the inline build byte for byte.
+// Sections the World skips (all air, or solid and boxed in by solid
+// sections) are counted and checked to mesh to nothing.
+// Then rebuilds each section with greedy meshing, reports the vertex and time
+// difference, and checks that the greedy mesh covers exactly the same
+// surface area on every face plane. Also checks that packed vertices
+// survive a decode/encode round trip and reports GPU bytes per chunk against
+// the previous float layout. Exits nonzero on any mismatch.
+//
+// Usage: bedwars_chunk_mesh_bench [--scene terrain|islands] [--map <file.rfmap>]
+//                                 [--side <chunks>] [--rounds <n>] [--threads <n>]
+// =============================================================================
+
+#include <engine/maps/rfmap_io.hpp>
+#include <engine/modules/voxel/client/chunk_mesh_workers.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using voxel::BlockType;
+using Clock = std::chrono::steady_clock;
+using BlockSource = std::function<BlockType(int wx, int y, int wz)>;
+
+struct Args {
+    std::string scene = "terrain";
+    std::string mapPath;
+    int side = 8;
+    int rounds = 3;
+    std::size_t threads = 0;  // 0 = default_thread_count(), at least 1
+};
+
+std::uint32_t hash3(int x, int y, int z) {
+    std::uint32_t h = static_cast<std::uint32_t>(x) * 73856093u ^
+                      static_cast<std::uint32_t>(y) * 19349663u ^
+                      static_cast<std::uint32_t>(z) * 83492791u;
+    h ^= h >> 13;
+    h *= 0x5bd1e995u;
+    h ^= h >> 15;
+    return h;
+}
+
+int surface_height(int wx, int wz) {
+    return 64 + static_cast<int>(8.0f * std::sin(static_cast<float>(wx) * 0.13f) +
+                                 6.0f * std::cos(static_cast<float>(wz) * 0.11f));
+}
+
+// Rolling hills with caves, ores, trees, vegetation and a few slabs/fences,
+// so every mesher path gets exercised. Pure function of world position, so
+// neighbour borders agree with the chunks they were taken from.
+BlockType terrain_block(int wx, int y, int wz) {
+    if (y == 0) return BlockType::Bedrock;
+
+    const int h = surface_height(wx, wz);
+    if (y < h) {
+        const float cave = std::sin(static_cast<float>(wx) * 0.21f) *
+                           std::sin(static_cast<float>(y) * 0.27f) *
+                           std::sin(static_cast<float>(wz) * 0.19f);
+        if (y > 8 && cave > 0.55f) return BlockType::Air;
+        if (y < h - 4) {
+            const std::uint32_t r = hash3(wx, y, wz) % 200;
+            if (r == 0) return BlockType::Diamond;
+            if (r < 3) return BlockType::Gold;
+            if (r < 8) return BlockType::Iron;
+            if (r < 16) return BlockType::Coal;
+            return BlockType::Stone;
+        }
+        return y == h - 1 ? BlockType::Grass : BlockType::Dirt;
+    }
+
+    // Trees on a coarse lattice: trunk of 5, leaf ball around the top
+    const int tx = (wx >= 0 ? wx / 9 : (wx - 8) / 9) * 9 + 4;
+    const int tz = (wz >= 0 ? wz / 9 : (wz - 8) / 9) * 9 + 4;
+    if ((hash3(tx, 0, tz) & 3u) == 0) {
+        const int base = surface_height(tx, tz);
+        if (wx == tx && wz == tz && y < base + 5) return BlockType::Wood;
+        const int dx = wx - tx;
+        const int dy = y - (base + 5);
+        const int dz = wz - tz;
+        if (dx * dx + dy * dy + dz * dz <= 6) return BlockType::Leaves;
+    }
+
+    if (y == h) {
+        const std::uint32_t r = hash3(wx, y, wz) % 64;
+        if (r < 6) return BlockType::TallGrass;
+        if (r == 6) return BlockType::Poppy;
+        if (r == 7) return BlockType::Dandelion;
+        if (r == 8) return BlockType::StoneSlab;
+        if (r == 9) return BlockType::OakFence;
+    }
+    return BlockType::Air;
+}
+
+// BedWars-style layout: flat team islands on a lattice with a raised
+// centre, walls and a base building per island, and open void between.
+BlockType islands_block(int wx, int y, int wz) {
+    constexpr int kSpacing = 40;
+    constexpr int kHalf = 10;
+    const int ix = (wx >= 0 ? wx / kSpacing : (wx - kSpacing + 1) / kSpacing) * kSpacing + kSpacing / 2;
+    const int iz = (wz >= 0 ? wz / kSpacing : (wz - kSpacing + 1) / kSpacing) * kSpacing + kSpacing / 2;
+    const int dx = wx - ix;
+    const int dz = wz - iz;
+    if (dx < -kHalf || dx > kHalf || dz < -kHalf || dz > kHalf) return BlockType::Air;
+
+    const int floor = ((ix / kSpacing + iz / kSpacing) & 1) ? 68 : 64;
+    if (y < floor - 3) return BlockType::Air;
+    if (y < floor - 1) return BlockType::Stone;
+    if (y == floor - 1) return (std::abs(dx) <= 2 && std::abs(dz) <= 2) ? BlockType::TeamRed : BlockType::Sand;
+
+    // Base building: hollow box with a doorway
+    const bool wall = (std::abs(dx) == 5 && std::abs(dz) <= 5) || (std::abs(dz) == 5 && std::abs(dx) <= 5);
+    if (wall && y < floor + 4 && !(dz == 5 && std::abs(dx) <= 1 && y < floor + 2)) return BlockType::Wood;
+    if (std::abs(dx) <= 5 && std::abs(dz) <= 5 && y == floor + 4) return BlockType::Stone;
+    return BlockType::Air;
+}
+
+// Rows outside the world keep reset()'s air default, as in capture_mesh_input
+void fill_snapshot(voxel::ChunkMeshInput& in, int cx, int cz, int section, const BlockSource& source) {
+    in.reset(cx, cz, section);
+    for (int ly = -1; ly <= voxel::CHUNK_SECTION_HEIGHT; ++ly) {
+        const int y = in.base_y() + ly;
+        if (y < 0 || y >= voxel::CHUNK_HEIGHT) continue;
+        for (int z = -1; z <= voxel::CHUNK_DEPTH; ++z) {
+            for (int x = -1; x <= voxel::CHUNK_WIDTH; ++x) {
+                in.blocks[voxel::ChunkMeshInput::index(x, ly, z)] = static_cast<voxel::Block>(
+                    source(cx * voxel::CHUNK_WIDTH + x, y, cz * voxel::CHUNK_DEPTH + z));
+            }
+        }
+    }
+}
+
+// Per-section counts matching Chunk's bookkeeping
+struct SectionCounts {
+    int non_air{0};
+    int full_opaque{0};
+};
+
+SectionCounts count_section(int cx, int cz, int section, const BlockSource& source) {
+    SectionCounts counts;
+    const int base = section * voxel::CHUNK_SECTION_HEIGHT;
+    for (int y = base; y < base + voxel::CHUNK_SECTION_HEIGHT; ++y) {
+        for (int z = 0; z < voxel::CHUNK_DEPTH; ++z) {
+            for (int x = 0; x < voxel::CHUNK_WIDTH; ++x) {
+                const BlockType type = source(cx * voxel::CHUNK_WIDTH + x, y, cz * voxel::CHUNK_DEPTH + z);
+                if (type != BlockType::Air) ++counts.non_air;
+                if (voxel::is_full_opaque(type)) ++counts.full_opaque;
+            }
+        }
+    }
+    return counts;
+}
+
+// Same rule as World::section_hidden, with every neighbour read from source
+// (map scenes read air past the map edge, like an unloaded chunk)
+bool section_hidden(int cx, int cz, int section, const BlockSource& source) {
+    const auto solid = [&](int x, int z, int s) {
+        return count_section(x, z, s, source).full_opaque == voxel::CHUNK_SECTION_SIZE;
+    };
+    const SectionCounts self = count_section(cx, cz, section, source);
+    if (self.non_air == 0) return true;
+    if (self.full_opaque != voxel::CHUNK_SECTION_SIZE) return false;
+    if (section < 1 || section >= voxel::CHUNK_SECTIONS - 1) return false;
+    return solid(cx, cz, section - 1) && solid(cx, cz, section + 1) &&
+           solid(cx - 1, cz, section) && solid(cx + 1, cz, section) &&
+           solid(cx, cz - 1, section) && solid(cx, cz + 1, section);
+}
+
+// Atlas layout without a GL context: distinct tiles per block type and
+// face so top/side/bottom are told apart.
+std::shared_ptr<const voxel::ChunkMeshContext> make_context() {
+    auto ctx = std::make_shared<voxel::ChunkMeshContext>();
+    for (std::size_t i = 0; i < voxel::ChunkMeshContext::kBlockTypes; ++i) {
+        for (std::size_t face = 0; face < 6; ++face) {
+            ctx->tile_ids[i][face] = static_cast<std::uint16_t>(i * 6 + face);
+        }
+    }
+    return ctx;
+}
+
+template <typename T>
+bool same(const std::vector<T>& a, const std::vector<T>& b) {
+    return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+bool same_mesh(const voxel::ChunkMeshData& a, const voxel::ChunkMeshData& b) {
+    if (a.empty != b.empty || a.light_markers.size() != b.light_markers.size()) return false;
+    return same(a.vertices, b.vertices);
+}
+
+bool same_packed(const voxel::PackedChunkVertex& a, const voxel::PackedChunkVertex& b) {
+    return std::memcmp(&a, &b, sizeof(a)) == 0;
+}
+
+// Every field on its quantisation grid must decode and re-encode to the
+// same bits; returns the number of failures.
+std::size_t check_vertex_codec() {
+    std::size_t failures = 0;
+    std::uint32_t seed = 1;
+    for (int i = 0; i < 4096; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        voxel::ChunkVertex v;
+        v.position = rf::Vec3{static_cast<float>(seed % (16 * 128)) / 128.0f,
+                              static_cast<float>((seed >> 4) % (256 * 128 + 1)) / 128.0f,
+                              static_cast<float>((seed >> 8) % (16 * 128 + 1)) / 128.0f};
+        v.uv = rf::Vec2{static_cast<float>((seed >> 3) % (16 * 16 + 1)) / 16.0f,
+                        static_cast<float>((seed >> 7) % (256 * 16 + 1)) / 16.0f};
+        v.normal = static_cast<int>(seed % voxel::kChunkNormalCount);
+        v.repeat = (seed & 0x100u) != 0;
+        v.light = static_cast<int>((seed >> 12) & 15u);
+        v.ao = static_cast<int>((seed >> 16) & 3u);
+        v.tint = static_cast<voxel::ChunkTint>((seed >> 18) % 3u);
+        v.tile = static_cast<int>((seed >> 20) & 0x3FFu);
+
+        const voxel::ChunkVertex back = voxel::decode_chunk_vertex(voxel::encode_chunk_vertex(v));
+        if (back.position != v.position || back.uv != v.uv || back.normal != v.normal ||
+            back.repeat != v.repeat || back.light != v.light || back.ao != v.ao || back.tint != v.tint ||
+            back.tile != v.tile) {
+            ++failures;
+        }
+    }
+    return failures;
+}
+
+// Triangle area per face plane: axis-aligned triangles keyed by normal and
+// plane offset (1/16 block steps for slabs and models), everything else in
+// one bucket. Equal maps mean two meshes cover the same surfaces.
+std::map<std::pair<int, long>, double> area_by_plane(const voxel::ChunkMeshData& mesh) {
+    static const int kQuadTriangles[2][3] = {{0, 1, 2}, {0, 2, 3}};
+    std::map<std::pair<int, long>, double> areas;
+    for (std::size_t q = 0; q + 4 <= mesh.vertices.size(); q += 4) {
+        voxel::ChunkVertex c[4];
+        for (std::size_t k = 0; k < 4; ++k) {
+            c[k] = voxel::decode_chunk_vertex(mesh.vertices[q + k]);
+        }
+        const int face = c[0].normal < 6 ? c[0].normal : -1;
+        const long plane = face < 0 ? 0 : std::lround(c[0].position[face / 2] * 16.0f);
+
+        for (const auto& tri : kQuadTriangles) {
+            const rf::Vec3& p0 = c[tri[0]].position;
+            const rf::Vec3& p1 = c[tri[1]].position;
+            const rf::Vec3& p2 = c[tri[2]].position;
+            const double ax = p1.x - p0.x, ay = p1.y - p0.y, az = p1.z - p0.z;
+            const double bx = p2.x - p0.x, by = p2.y - p0.y, bz = p2.z - p0.z;
+            const double cx = ay * bz - az * by, cy = az * bx - ax * bz, cz = ax * by - ay * bx;
+            areas[{face, plane}] += 0.5 * std::sqrt(cx * cx + cy * cy + cz * cz);
+        }
+    }
+    return areas;
+}
+
+bool same_area(const std::map<std::pair<int, long>, double>& a, const std::map<std::pair<int, long>, double>& b) {
+    if (a.size() != b.size()) return false;
+    for (auto ia = a.begin(), ib = b.begin(); ia != a.end(); ++ia, ++ib) {
+        if (ia->first != ib->first || std::fabs(ia->second - ib->second) > 1e-6 * std::max(1.0, ia->second)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void print_usage(const char* progname) {
+    std::printf("Usage: %s [options]\n\n", progname);
+    std::printf("Options:\n");
+    std::printf("  --scene <name>    terrain (hills, caves, trees) or islands (flat BedWars layout)\n");
+    std::printf("  --map <file>      Mesh every chunk of an .rfmap instead of a scene\n");
+    std::printf("  --side <n>        Scene size in chunks per side (default: 8)\n");
+    std::printf("  --rounds <n>      Worker rounds (default: 3)\n");
+    std::printf("  --threads <n>     Worker threads (default: hardware threads - 1, at least 1)\n");
+}
+
+bool parse_args(int argc, char** argv, Args& args) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--scene") == 0 && i + 1 < argc) {
+            args.scene = argv[++i];
+        } else if (std::strcmp(arg, "--map") == 0 && i + 1 < argc) {
+            args.mapPath = argv[++i];
+        } else if (std::strcmp(arg, "--side") == 0 && i + 1 < argc) {
+            args.side = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--rounds") == 0 && i + 1 < argc) {
+            args.rounds = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--threads") == 0 && i + 1 < argc) {
+            args.threads = std::strtoul(argv[++i], nullptr, 10);
+        } else {
+            return false;
+        }
+    }
+    return args.side > 0 && args.rounds > 0 && (args.scene == "terrain" || args.scene == "islands");
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Args args;
+    if (!parse_args(argc, argv, args)) {
+        print_usage(argv[0]);
+        return 2;
+    }
+    const std::size_t threads = args.threads > 0
+        ? args.threads
+        : std::max<std::size_t>(voxel::ChunkMeshWorkers::default_thread_count(), 1);
+    const int rounds = args.rounds;
+
+    // Chunk coordinates to mesh and where their blocks come from
+    std::vector<std::pair<int, int>> coords;
+    BlockSource source;
+    shared::maps::MapTemplate map;
+    if (!args.mapPath.empty()) {
+        std::string error;
+        if (!shared::maps::read_rfmap(args.mapPath, &map, &error)) {
+            std::fprintf(stderr, "%s: %s\n", args.mapPath.c_str(), error.c_str());
+            return 1;
+        }
+        for (const auto& [key, chunk] : map.chunks) {
+            (void)chunk;
+            coords.push_back(key);
+        }
+        std::sort(coords.begin(), coords.end());
+        source = [&map](int wx, int y, int wz) {
+            const int cx = wx >= 0 ? wx / voxel::CHUNK_WIDTH : (wx - voxel::CHUNK_WIDTH + 1) / voxel::CHUNK_WIDTH;
+            const int cz = wz >= 0 ? wz / voxel::CHUNK_DEPTH : (wz - voxel::CHUNK_DEPTH + 1) / voxel::CHUNK_DEPTH;
+            const auto* chunk = map.find_chunk(cx, cz);
+            if (!chunk) return BlockType::Air;
+            const int lx = wx - cx * voxel::CHUNK_WIDTH;
+            const int lz = wz - cz * voxel::CHUNK_DEPTH;
+            return chunk->blocks[static_cast<std::size_t>((y * voxel::CHUNK_DEPTH + lz) * voxel::CHUNK_WIDTH + lx)];
+        };
+    } else {
+        for (int cz = 0; cz < args.side; ++cz) {
+            for (int cx = 0; cx < args.side; ++cx) {
+                coords.emplace_back(cx - args.side / 2, cz - args.side / 2);
+            }
+        }
+        source = args.scene == "islands" ? BlockSource(islands_block) : BlockSource(terrain_block);
+    }
+
+    const auto ctx = make_context();
+    const std::size_t chunkCount = coords.size();
+    if (chunkCount == 0) {
+        std::fprintf(stderr, "nothing to mesh\n");
+        return 1;
+    }
+
+    // Snapshots of the sections the World would mesh; the ones it skips must
+    // build to no vertices
+    std::vector<std::unique_ptr<voxel::ChunkMeshInput>> snapshots;
+    std::size_t airSections = 0;
+    std::size_t hiddenSections = 0;
+    std::size_t skippedWithFaces = 0;
+    {
+        voxel::ChunkMeshData out;
+        for (const auto& [cx, cz] : coords) {
+            for (int section = 0; section < voxel::CHUNK_SECTIONS; ++section) {
+                auto in = std::make_unique<voxel::ChunkMeshInput>();
+                fill_snapshot(*in, cx, cz, section, source);
+                if (!section_hidden(cx, cz, section, source)) {
+                    snapshots.push_back(std::move(in));
+                    continue;
+                }
+
+                ++(count_section(cx, cz, section, source).non_air == 0 ? airSections : hiddenSections);
+                voxel::build_chunk_mesh(*in, *ctx, out);
+                if (out.vertex_count() > 0 || !out.light_markers.empty()) {
+                    if (skippedWithFaces == 0) {
+                        std::fprintf(stderr, "chunk (%d, %d) section %d: skipped section has visible faces\n",
+                                     cx, cz, section);
+                    }
+                    ++skippedWithFaces;
+                }
+            }
+        }
+    }
+    const std::size_t sectionCount = snapshots.size();
+    if (sectionCount == 0) {
+        std::fprintf(stderr, "every section is skipped, nothing to mesh\n");
+        return 1;
+    }
+
+    // Reference: single-threaded builds (skylight stays at the snapshot's
+    // full-sky default; lighting has its own bench)
+    std::vector<std::unique_ptr<voxel::ChunkMeshData>> reference;
+    reference.reserve(sectionCount);
+    std::size_t totalVertices = 0;
+    double inlineMs = 0.0;
+    {
+        for (const auto& snap : snapshots) {
+            auto out = std::make_unique<voxel::ChunkMeshData>();
+            const auto t0 = Clock::now();
+            voxel::build_chunk_mesh(*snap, *ctx, *out);
+            inlineMs += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+            totalVertices += static_cast<std::size_t>(out->vertex_count());
+            reference.push_back(std::move(out));
+        }
+    }
+
+    // Packed vertices: codec round trip on synthetic values and on every
+    // vertex the mesher produced
+    std::size_t codecFailures = check_vertex_codec();
+    for (const auto& mesh : reference) {
+        for (const auto& v : mesh->vertices) {
+            if (!same_packed(voxel::encode_chunk_vertex(voxel::decode_chunk_vertex(v)), v)) ++codecFailures;
+        }
+        if (mesh->vertices.size() % 4 != 0) ++codecFailures;
+    }
+
+    // Workers: same snapshots, results popped, checked and recycled as the
+    // World does, several rounds so later rounds run on reused buffers
+    voxel::ChunkMeshWorkers workers(threads, threads * 4);
+    double workerMs = 0.0;
+    std::size_t mismatches = 0;
+    for (int round = 0; round < rounds; ++round) {
+        const auto t0 = Clock::now();
+        std::size_t next = 0;
+        std::size_t done = 0;
+        while (done < sectionCount) {
+            while (next < sectionCount && workers.can_submit()) {
+                voxel::ChunkMeshJob job = workers.make_job();
+                job.ticket = next + 1;
+                job.context = ctx;
+                *job.input = *snapshots[next];
+                workers.submit(std::move(job));
+                ++next;
+            }
+            voxel::ChunkMeshJob job;
+            if (!workers.try_pop_completed(job)) {
+                std::this_thread::yield();
+                continue;
+            }
+            const std::size_t i = static_cast<std::size_t>(job.ticket - 1);
+            if (!same_mesh(*job.output, *reference[i])) {
+                if (mismatches == 0) {
+                    std::fprintf(stderr, "round %d: chunk (%d, %d) section %d differs from the inline build\n",
+                                 round, job.input->chunk_x, job.input->chunk_z, job.input->section);
+                }
+                ++mismatches;
+            }
+            workers.recycle(std::move(job));
+            ++done;
+        }
+        workerMs += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    }
+
+    // Greedy meshing: same snapshots, full-cube faces merged
+    auto greedyCtx = std::make_shared<voxel::ChunkMeshContext>(*ctx);
+    greedyCtx->greedy_full_faces = true;
+    std::size_t greedyVertices = 0;
+    std::size_t greedyMismatches = 0;
+    double greedyMs = 0.0;
+    {
+        voxel::ChunkMeshData out;
+        for (std::size_t i = 0; i < sectionCount; ++i) {
+            const auto t0 = Clock::now();
+            voxel::build_chunk_mesh(*snapshots[i], *greedyCtx, out);
+            greedyMs += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+            greedyVertices += static_cast<std::size_t>(out.vertex_count());
+
+            if (!same_area(area_by_plane(out), area_by_plane(*reference[i]))) {
+                if (greedyMismatches == 0) {
+                    std::fprintf(stderr, "chunk (%d, %d) section %d: greedy mesh does not cover the same faces\n",
+                                 snapshots[i]->chunk_x, snapshots[i]->chunk_z, snapshots[i]->section);
+                }
+                ++greedyMismatches;
+            }
+        }
+    }
+
+    const double perSectionInline = inlineMs / static_cast<double>(sectionCount);
+    const double perSectionWorkers = workerMs / static_cast<double>(sectionCount * static_cast<std::size_t>(rounds));
+    std::printf("%s: %zu chunks, %zu vertices (%.0f per chunk)\n",
+                args.mapPath.empty() ? args.scene.c_str() : args.mapPath.c_str(), chunkCount, totalVertices,
+                static_cast<double>(totalVertices) / static_cast<double>(chunkCount));
+    std::printf("  sections:      %zu meshed, %zu all air and %zu solid interior skipped (%.1f%%)\n",
+                sectionCount, airSections, hiddenSections,
+                100.0 * static_cast<double>(airSections + hiddenSections) /
+                    static_cast<double>(chunkCount * voxel::CHUNK_SECTIONS));
+    std::printf("  inline:        %8.3f ms/section, %.3f ms/chunk\n", perSectionInline,
+                inlineMs / static_cast<double>(chunkCount));
+    std::printf("  %zu worker(s):  %8.3f ms/section wall (%.2fx), %d round(s)\n", threads, perSectionWorkers,
+                perSectionWorkers > 0.0 ? perSectionInline / perSectionWorkers : 0.0, rounds);
+
+    std::printf("  greedy:        %8.3f ms/section, %zu vertices (%.1f%% of plain)\n",
+                greedyMs / static_cast<double>(sectionCount), greedyVertices,
+                totalVertices > 0 ? 100.0 * static_cast<double>(greedyVertices) / static_cast<double>(totalVertices)
+                                  : 0.0);
+
+    // Previous layout: 6 vertices per face, 10 floats + 4 colour bytes each
+    const std::size_t totalQuads = totalVertices / 4;
+    const double packedKb = static_cast<double>(totalVertices * sizeof(voxel::PackedChunkVertex)) / 1024.0;
+    const double floatKb = static_cast<double>(totalQuads * 6 * (10 * sizeof(float) + 4)) / 1024.0;
+    std::printf("  vertex data:   %8.1f KiB/chunk packed vs %.1f KiB/chunk float (%.2fx smaller)\n",
+                packedKb / static_cast<double>(chunkCount), floatKb / static_cast<double>(chunkCount),
+                packedKb > 0.0 ? floatKb / packedKb : 0.0);
+
+    if (skippedWithFaces > 0) {
+        std::fprintf(stderr, "FAIL: %zu skipped sections would have produced faces\n", skippedWithFaces);
+        return 1;
+    }
+    if (codecFailures > 0) {
+        std::fprintf(stderr, "FAIL: %zu packed vertices do not survive a decode/encode round trip\n", codecFailures);
+        return 1;
+    }
+    if (greedyMismatches > 0) {
+        std::fprintf(stderr, "FAIL: %zu greedy meshes differ in coverage from the plain build\n", greedyMismatches);
+        return 1;
+    }
+    if (mismatches > 0) {
+        std::fprintf(stderr, "FAIL: %zu worker meshes differ from the inline build\n", mismatches);
+        return 1;
+    }
+    std::printf("  skipped sections have no faces; worker output matches inline build; greedy coverage matches plain "
+                "build; codec round trips\n");
+    return 0;
+}
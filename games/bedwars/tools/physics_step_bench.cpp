@@ -0,0 +1,154 @@
+// =============================================================================
+// Player physics step benchmark
+// Runs the same walking/jumping input stream for a group of players over
+// procedural terrain with player-built bridges and pillars, once reading
+// Terrain directly per block and once through the per-step LocalBlockCache,
+// and reports the cost of one player step and the Terrain lookups it made.
+//
+// Usage: bedwars_physics_step_bench [players] [ticks]
+// =============================================================================
+
+#include "shared/physics/physics_utils.hpp"
+#include "server/voxel/terrain.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+using shared::voxel::BlockType;
+using Clock = std::chrono::steady_clock;
+
+constexpr float kDt = 1.0f / 30.0f;
+
+struct Body {
+    float px, py, pz;
+    float vx{0.0f}, vy{0.0f}, vz{0.0f};
+    bool onGround{false};
+    bool lastJumpHeld{false};
+};
+
+struct Input {
+    float moveX, moveY, yaw;
+    bool jump, sprint;
+};
+
+// Terrain wrapper that counts what the physics step asks for.
+struct CountingTerrain {
+    const bedwars::voxel::Terrain& terrain;
+    mutable std::uint64_t lookups{0};
+
+    BlockType get_block(int x, int y, int z) const {
+        ++lookups;
+        return terrain.get_block(x, y, z);
+    }
+    shared::voxel::BlockRuntimeState get_block_state(int x, int y, int z) const {
+        ++lookups;
+        return terrain.get_block_state(x, y, z);
+    }
+};
+
+int surface_y(const bedwars::voxel::Terrain& terrain, int x, int z) {
+    for (int y = 120; y > 0; --y) {
+        if (shared::voxel::get_collision_info(terrain.get_block(x, y, z)).hasCollision) return y + 1;
+    }
+    return 64;
+}
+
+// Bridges, pillars, slabs and fences near the spawn area so overrides are hit.
+void build_structures(bedwars::voxel::Terrain& terrain) {
+    std::mt19937 rng(99);
+    std::uniform_int_distribution<int> xz(-24, 23);
+    const BlockType kinds[] = {BlockType::TeamRed, BlockType::StoneSlab, BlockType::OakFence, BlockType::Wood};
+    for (int i = 0; i < 400; ++i) {
+        const int x = xz(rng);
+        const int z = xz(rng);
+        const int y = surface_y(terrain, x, z);
+        terrain.place_player_block(x, y, z, kinds[static_cast<std::size_t>(i) % 4]);
+    }
+}
+
+template <typename Step>
+double run(std::vector<Body> bodies, const std::vector<Input>& inputs, std::size_t ticks,
+           Step&& step, std::vector<Body>& out) {
+    double us = 0.0;
+    for (std::size_t t = 0; t < ticks; ++t) {
+        const auto t0 = Clock::now();
+        for (std::size_t i = 0; i < bodies.size(); ++i) {
+            const Input& in = inputs[(t * bodies.size() + i) % inputs.size()];
+            step(bodies[i], in);
+        }
+        us += std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+    }
+    out = std::move(bodies);
+    return us;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t players = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 32;
+    const std::size_t ticks = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 3000;
+
+    bedwars::voxel::Terrain terrain(12345);
+    build_structures(terrain);
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> xz(-16, 15);
+    std::vector<Body> start(players);
+    for (auto& b : start) {
+        const int x = xz(rng);
+        const int z = xz(rng);
+        b.px = static_cast<float>(x) + 0.5f;
+        b.pz = static_cast<float>(z) + 0.5f;
+        b.py = static_cast<float>(surface_y(terrain, x, z));
+    }
+
+    // Inputs change every half second per player, like someone running around
+    std::uniform_real_distribution<float> axis(-1.0f, 1.0f);
+    std::uniform_real_distribution<float> yaw(0.0f, 360.0f);
+    std::vector<Input> inputs(players * 15 * 64);
+    for (std::size_t i = 0; i < inputs.size(); i += 15) {
+        const Input in{axis(rng), axis(rng), yaw(rng), (rng() % 4) == 0, (rng() % 2) == 0};
+        for (std::size_t k = 0; k < 15 && i + k < inputs.size(); ++k) inputs[i + k] = in;
+    }
+
+    CountingTerrain direct{terrain};
+    std::vector<Body> directEnd;
+    const double directUs = run(start, inputs, ticks,
+        [&](Body& b, const Input& in) {
+            bedwars::physics::simulate_physics_step_uncached(
+                direct, b.px, b.py, b.pz, b.vx, b.vy, b.vz, b.onGround, b.lastJumpHeld,
+                in.moveX, in.moveY, in.yaw, in.jump, in.sprint, kDt);
+        }, directEnd);
+
+    CountingTerrain cached{terrain};
+    std::vector<Body> cachedEnd;
+    const double cachedUs = run(start, inputs, ticks,
+        [&](Body& b, const Input& in) {
+            bedwars::physics::simulate_physics_step(
+                cached, b.px, b.py, b.pz, b.vx, b.vy, b.vz, b.onGround, b.lastJumpHeld,
+                in.moveX, in.moveY, in.yaw, in.jump, in.sprint, kDt);
+        }, cachedEnd);
+
+    const double steps = static_cast<double>(players * ticks);
+    std::printf("%zu players x %zu ticks\n", players, ticks);
+    std::printf("  direct terrain  %6.3f us/step  %5.1f lookups/step\n",
+                directUs / steps, static_cast<double>(direct.lookups) / steps);
+    std::printf("  block cache     %6.3f us/step  %5.1f lookups/step  (%.2fx)\n",
+                cachedUs / steps, static_cast<double>(cached.lookups) / steps,
+                cachedUs > 0.0 ? directUs / cachedUs : 0.0);
+
+    for (std::size_t i = 0; i < players; ++i) {
+        const Body& a = directEnd[i];
+        const Body& b = cachedEnd[i];
+        if (a.px != b.px || a.py != b.py || a.pz != b.pz || a.onGround != b.onGround) {
+            std::fprintf(stderr, "player %zu diverged\n", i);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,278 @@
+// =============================================================================
+// Headless replay runner
+// Feeds a replay log recorded by ServerEngine (--record) back through
+// BedWarsServer with no network and no tick pacing, then reports how fast
+// the ticks ran and the per-phase tick profile. Every outbound message is
+// folded into a checksum; --trace writes one checksum per tick so two builds
+// can be diffed for the first tick where their output diverges.
+//
+// Usage: bedwars_replay_runner <log> [--map <name>] [--editor]
+//                              [--sim-workers <n>] [--trace <file>] [--verbose]
+// =============================================================================
+
+#include "server/bedwars_server.hpp"
+
+#include <engine/core/game_interface.hpp>
+#include <engine/core/replay_log.hpp>
+#include <engine/core/tick_profiler.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Args {
+    std::string logPath;
+    std::string mapName;  // Empty = map id from the log
+    bool editorMode = false;
+    std::size_t simWorkers = 0;
+    std::string tracePath;
+    bool verbose = false;
+};
+
+// FNV-1a, 64-bit
+constexpr std::uint64_t kFnvOffset = 1469598103934665603ull;
+constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+
+std::uint64_t fnv1a(std::uint64_t h, const void* data, std::size_t size) {
+    const auto* p = static_cast<const std::uint8_t*>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+        h = (h ^ p[i]) * kFnvPrime;
+    }
+    return h;
+}
+
+// Engine stand-in: sends are hashed and counted instead of transmitted.
+// Game-initiated disconnects are ignored; the transport's resulting
+// Disconnect event is already in the log at the tick it happened.
+class HeadlessServices final : public engine::IEngineServices {
+public:
+    HeadlessServices(float tickRate, bool verbose)
+        : tickRate_(tickRate), tickDt_(1.0f / tickRate), verbose_(verbose), profiler_(tickRate) {}
+
+    void send(engine::PlayerId id, std::span<const std::uint8_t> data, engine::Delivery) override {
+        hash_ = fnv1a(hash_, &id, sizeof(id));
+        hash_ = fnv1a(hash_, data.data(), data.size());
+        ++messagesSent;
+        bytesSent += data.size();
+    }
+
+    void broadcast(std::span<const std::uint8_t> data, engine::Delivery) override {
+        const std::uint32_t all = 0xFFFFFFFFu;
+        hash_ = fnv1a(hash_, &all, sizeof(all));
+        hash_ = fnv1a(hash_, data.data(), data.size());
+        ++messagesSent;
+        bytesSent += data.size();
+    }
+
+    void disconnect(engine::PlayerId) override {}
+
+    engine::Tick current_tick() const override { return tick; }
+    float tick_rate() const override { return tickRate_; }
+    float tick_dt() const override { return tickDt_; }
+
+    void log(engine::LogLevel level, std::string_view msg) override {
+        if (!verbose_ && level < engine::LogLevel::Warning) return;
+        std::fprintf(stderr, "[tick %llu] %.*s\n", static_cast<unsigned long long>(tick),
+                     static_cast<int>(msg.size()), msg.data());
+    }
+
+    engine::TickProfiler* profiler() override { return &profiler_; }
+
+    void set_session_info(std::uint32_t seed, std::string_view mapId,
+                          std::uint32_t mapVersion) override {
+        replayed.seed = seed;
+        replayed.mapId = std::string(mapId);
+        replayed.mapVersion = mapVersion;
+    }
+
+    std::uint64_t hash() const { return hash_; }
+
+    engine::Tick tick{0};
+    std::uint64_t messagesSent{0};
+    std::uint64_t bytesSent{0};
+    engine::ReplaySessionInfo replayed;
+
+private:
+    float tickRate_;
+    float tickDt_;
+    bool verbose_;
+    engine::TickProfiler profiler_;
+    std::uint64_t hash_{kFnvOffset};
+};
+
+void print_usage(const char* progname) {
+    std::printf("Usage: %s <log> [options]\n\n", progname);
+    std::printf("Options:\n");
+    std::printf("  --map <name>        Map file to load (default: map id from the log)\n");
+    std::printf("  --editor            Replay a server that ran with --editor\n");
+    std::printf("  --sim-workers <n>   Extra threads for player movement (default: 0)\n");
+    std::printf("  --trace <file>      Write '<tick> <output checksum>' per tick\n");
+    std::printf("  --verbose           Show game info/debug log lines\n");
+}
+
+bool parse_args(int argc, char** argv, Args& args) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--map") == 0 && i + 1 < argc) {
+            args.mapName = argv[++i];
+        } else if (std::strcmp(arg, "--editor") == 0) {
+            args.editorMode = true;
+        } else if (std::strcmp(arg, "--sim-workers") == 0 && i + 1 < argc) {
+            args.simWorkers = std::strtoul(argv[++i], nullptr, 10);
+        } else if (std::strcmp(arg, "--trace") == 0 && i + 1 < argc) {
+            args.tracePath = argv[++i];
+        } else if (std::strcmp(arg, "--verbose") == 0) {
+            args.verbose = true;
+        } else if (arg[0] != '-' && args.logPath.empty()) {
+            args.logPath = arg;
+        } else {
+            return false;
+        }
+    }
+    return !args.logPath.empty();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Args args;
+    if (!parse_args(argc, argv, args)) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    // Load the whole log up front so file I/O stays out of the timings
+    engine::ReplayReader reader;
+    std::string error;
+    if (!reader.open(args.logPath, &error)) {
+        std::fprintf(stderr, "%s: %s\n", args.logPath.c_str(), error.c_str());
+        return 1;
+    }
+
+    std::vector<engine::ReplayRecord> events;
+    engine::ReplaySessionInfo session;
+    bool haveSession = false;
+    engine::Tick endTick = 0;
+    bool cleanEnd = false;
+    std::uint64_t inboundBytes = 0;
+
+    engine::ReplayRecord record;
+    while (reader.next(record)) {
+        switch (record.kind) {
+            case engine::ReplayRecordKind::Session:
+                haveSession = engine::ReplayReader::parse_session(record.data, session);
+                break;
+            case engine::ReplayRecordKind::End:
+                endTick = record.tick;
+                cleanEnd = true;
+                break;
+            default:
+                inboundBytes += record.data.size();
+                endTick = std::max(endTick, record.tick + 1);
+                events.push_back(std::move(record));
+                break;
+        }
+        record = {};
+    }
+    if (reader.truncated()) {
+        std::fprintf(stderr, "warning: log ends in a partial record (server crashed?)\n");
+    }
+    if (!haveSession) {
+        std::fprintf(stderr, "%s: no session record, cannot rebuild the world\n", args.logPath.c_str());
+        return 1;
+    }
+
+    bedwars::server::BedWarsServer::Options opts;
+    opts.editorCameraMode = args.editorMode;
+    opts.autoStartMatch = !args.editorMode;
+    opts.loadMapTemplate = !session.mapId.empty();
+    opts.mapName = args.mapName.empty() ? session.mapId : args.mapName;
+    opts.simulationWorkers = args.simWorkers;
+
+    HeadlessServices services(reader.tick_rate(), args.verbose);
+    bedwars::server::BedWarsServer game(session.seed, opts);
+    game.on_init(services);
+
+    if (services.replayed.seed != session.seed || services.replayed.mapId != session.mapId ||
+        services.replayed.mapVersion != session.mapVersion) {
+        std::fprintf(stderr, "world mismatch: log has seed %u map '%s' v%u, replay loaded seed %u map '%s' v%u\n",
+                     session.seed, session.mapId.c_str(), session.mapVersion,
+                     services.replayed.seed, services.replayed.mapId.c_str(), services.replayed.mapVersion);
+        game.on_shutdown();
+        return 1;
+    }
+
+    std::FILE* trace = nullptr;
+    if (!args.tracePath.empty()) {
+        trace = std::fopen(args.tracePath.c_str(), "w");
+        if (!trace) {
+            std::fprintf(stderr, "cannot write %s\n", args.tracePath.c_str());
+            game.on_shutdown();
+            return 1;
+        }
+    }
+
+    // Same order as ServerEngine: the tick's inbound events, then on_tick
+    engine::TickProfiler& profiler = *services.profiler();
+    const float dt = services.tick_dt();
+    std::size_t next = 0;
+    const auto start = Clock::now();
+    for (engine::Tick t = 0; t < endTick; ++t) {
+        services.tick = t;
+        const auto tickStart = Clock::now();
+
+        for (; next < events.size() && events[next].tick == t; ++next) {
+            const auto& e = events[next];
+            switch (e.kind) {
+                case engine::ReplayRecordKind::Connect:
+                    game.on_player_connect(e.player);
+                    break;
+                case engine::ReplayRecordKind::Disconnect:
+                    game.on_player_disconnect(e.player);
+                    break;
+                case engine::ReplayRecordKind::Message:
+                    game.on_player_message(e.player, e.data);
+                    break;
+                default:
+                    break;
+            }
+        }
+        game.on_tick(dt);
+
+        profiler.end_tick(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - tickStart).count()));
+        if (trace) {
+            std::fprintf(trace, "%llu %016llx\n", static_cast<unsigned long long>(t),
+                         static_cast<unsigned long long>(services.hash()));
+        }
+    }
+    const double wallSec = std::chrono::duration<double>(Clock::now() - start).count();
+
+    game.on_shutdown();
+    if (trace) std::fclose(trace);
+
+    const double gameSec = static_cast<double>(endTick) / static_cast<double>(reader.tick_rate());
+    std::printf("%s: seed %u, map '%s' v%u, %.0f TPS%s\n", args.logPath.c_str(), session.seed,
+                session.mapId.c_str(), session.mapVersion, static_cast<double>(reader.tick_rate()),
+                cleanEnd ? "" : " (no end record)");
+    std::printf("  %llu ticks (%.1f s of play), %zu inbound events, %llu bytes\n",
+                static_cast<unsigned long long>(endTick), gameSec, events.size(),
+                static_cast<unsigned long long>(inboundBytes));
+    std::printf("  replayed in %.3f s: %.0f ticks/s, %.1fx real time\n", wallSec,
+                wallSec > 0.0 ? static_cast<double>(endTick) / wallSec : 0.0,
+                wallSec > 0.0 ? gameSec / wallSec : 0.0);
+    std::printf("  output: %llu messages, %llu bytes, checksum %016llx\n",
+                static_cast<unsigned long long>(services.messagesSent),
+                static_cast<unsigned long long>(services.bytesSent),
+                static_cast<unsigned long long>(services.hash()));
+    std::printf("%s\n", profiler.report().c_str());
+    return 0;
+}
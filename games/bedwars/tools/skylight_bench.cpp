@@ -0,0 +1,430 @@
+// =============================================================================
+// Skylight benchmark
+// Lights a grid of chunks, then applies random block edits (many on chunk
+// borders) plus chunk unloads and reloads through SkylightPropagator. After
+// every edit the incremental result is compared against lighting the same
+// blocks from scratch, and periodically against an independent fixed-point
+// solver. Chunks report their height rounded up to a whole section, as
+// Chunk::height() does, so the open sky above is lit without being walked.
+// Also checks that every chunk whose light changed was reported, with the
+// right border and section bits. Reports incremental vs full relight cost.
+// Exits nonzero on any mismatch.
+//
+// Usage: bedwars_skylight_bench [--side <chunks>] [--edits <n>] [--seed <n>]
+//                               [--solver-every <n>]
+// =============================================================================
+
+#include <engine/modules/voxel/client/skylight.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using voxel::Block;
+using voxel::BlockType;
+using voxel::CHUNK_DEPTH;
+using voxel::CHUNK_HEIGHT;
+using voxel::CHUNK_SIZE;
+using voxel::CHUNK_WIDTH;
+using Clock = std::chrono::steady_clock;
+using ChunkKey = std::pair<int, int>;
+
+struct Args {
+    int side = 3;
+    int edits = 400;
+    unsigned seed = 1;
+    int solverEvery = 50;  // Edits between fixed-point solver checks
+};
+
+std::size_t chunk_index(int lx, int y, int lz) {
+    return static_cast<std::size_t>(y) * CHUNK_WIDTH * CHUNK_DEPTH + static_cast<std::size_t>(lz) * CHUNK_WIDTH +
+           static_cast<std::size_t>(lx);
+}
+
+int floor_div(int value, int size) {
+    return value >= 0 ? value / size : (value - size + 1) / size;
+}
+
+bool opaque(Block block) {
+    const auto type = static_cast<BlockType>(block);
+    return voxel::is_solid(type) && !voxel::is_transparent(type);
+}
+
+bool dims(Block block) {
+    const auto type = static_cast<BlockType>(block);
+    return type == BlockType::Leaves || type == BlockType::Water;
+}
+
+// Hills with a pond, tree canopies and a floating roof, so light has to
+// come in sideways, under overhangs and through leaves and water.
+BlockType scene_block(int wx, int y, int wz) {
+    if (y == 0) return BlockType::Bedrock;
+    const int h = 60 + static_cast<int>(5.0f * std::sin(static_cast<float>(wx) * 0.17f) +
+                                        4.0f * std::cos(static_cast<float>(wz) * 0.13f));
+    if (y < h) return y < h - 3 ? BlockType::Stone : BlockType::Dirt;
+    if (y < 60 && std::abs(wx - 6) + std::abs(wz - 20) < 8) return BlockType::Water;
+    if (y == 72 && wx > -4 && wx < 14 && wz > 2 && wz < 12) return BlockType::Stone;
+    if (y >= 66 && y <= 68 && ((wx + 64) % 11) < 4 && ((wz + 64) % 9) < 4) return BlockType::Leaves;
+    return BlockType::Air;
+}
+
+struct GridChunk {
+    std::vector<Block> blocks = std::vector<Block>(CHUNK_SIZE, static_cast<Block>(BlockType::Air));
+    voxel::LightNibbles light;
+    int height{0};
+    bool loaded{true};
+
+    // Top of the highest section holding a non-air block
+    void update_height() {
+        height = 0;
+        for (int y = CHUNK_HEIGHT - 1; y >= 0 && height == 0; --y) {
+            for (int i = 0; i < CHUNK_WIDTH * CHUNK_DEPTH; ++i) {
+                if (blocks[static_cast<std::size_t>(y * CHUNK_WIDTH * CHUNK_DEPTH + i)] !=
+                    static_cast<Block>(BlockType::Air)) {
+                    height = (y / voxel::CHUNK_SECTION_HEIGHT + 1) * voxel::CHUNK_SECTION_HEIGHT;
+                    break;
+                }
+            }
+        }
+    }
+};
+
+class Grid final : public voxel::SkylightAccess {
+public:
+    std::map<ChunkKey, GridChunk> chunks;
+
+    voxel::SkylightChunk chunk(int cx, int cz) override {
+        auto it = chunks.find({cx, cz});
+        if (it == chunks.end() || !it->second.loaded) return {};
+        return {it->second.blocks.data(), &it->second.light, it->second.height};
+    }
+
+    std::vector<ChunkKey> loaded() const {
+        std::vector<ChunkKey> out;
+        for (const auto& [key, c] : chunks) {
+            if (c.loaded) out.push_back(key);
+        }
+        return out;
+    }
+
+    const GridChunk* find(int wx, int wz) const {
+        auto it = chunks.find({floor_div(wx, CHUNK_WIDTH), floor_div(wz, CHUNK_DEPTH)});
+        return it != chunks.end() && it->second.loaded ? &it->second : nullptr;
+    }
+
+    Block block(int wx, int y, int wz) const {
+        const GridChunk* c = find(wx, wz);
+        if (!c || y < 0 || y >= CHUNK_HEIGHT) return static_cast<Block>(BlockType::Air);
+        return c->blocks[chunk_index(wx - floor_div(wx, CHUNK_WIDTH) * CHUNK_WIDTH, y,
+                                     wz - floor_div(wz, CHUNK_DEPTH) * CHUNK_DEPTH)];
+    }
+};
+
+// Reference: relax every cell to max(source, best neighbour - decay) until
+// nothing changes, with unloaded neighbours as open sky at 15. Shares no
+// code with the propagator.
+std::map<ChunkKey, std::vector<std::uint8_t>> solve_fixed_point(const Grid& grid) {
+    std::map<ChunkKey, std::vector<std::uint8_t>> light;
+    for (const ChunkKey& key : grid.loaded()) {
+        const GridChunk& c = grid.chunks.at(key);
+        auto& out = light[key];
+        out.assign(CHUNK_SIZE, 0);
+        for (int lz = 0; lz < CHUNK_DEPTH; ++lz) {
+            for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+                int sun = 15;
+                for (int y = CHUNK_HEIGHT - 1; y >= 0; --y) {
+                    const Block b = c.blocks[chunk_index(lx, y, lz)];
+                    if (opaque(b)) sun = 0;
+                    else if (dims(b)) sun = std::max(sun - 1, 0);
+                    out[chunk_index(lx, y, lz)] = static_cast<std::uint8_t>(sun);
+                }
+            }
+        }
+    }
+
+    const auto value = [&](int wx, int y, int wz) -> int {
+        const int cx = floor_div(wx, CHUNK_WIDTH);
+        const int cz = floor_div(wz, CHUNK_DEPTH);
+        auto it = light.find({cx, cz});
+        if (it == light.end()) return 15;  // Unloaded: open sky
+        return it->second[chunk_index(wx - cx * CHUNK_WIDTH, y, wz - cz * CHUNK_DEPTH)];
+    };
+
+    static constexpr int kDx[6] = {1, -1, 0, 0, 0, 0};
+    static constexpr int kDy[6] = {0, 0, 1, -1, 0, 0};
+    static constexpr int kDz[6] = {0, 0, 0, 0, 1, -1};
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (auto& [key, out] : light) {
+            const GridChunk& c = grid.chunks.at(key);
+            for (int y = 0; y < CHUNK_HEIGHT; ++y) {
+                for (int lz = 0; lz < CHUNK_DEPTH; ++lz) {
+                    for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+                        const std::size_t i = chunk_index(lx, y, lz);
+                        if (opaque(c.blocks[i])) continue;
+                        const int wx = key.first * CHUNK_WIDTH + lx;
+                        const int wz = key.second * CHUNK_DEPTH + lz;
+                        int best = out[i];
+                        for (int d = 0; d < 6; ++d) {
+                            const int ny = y + kDy[d];
+                            if (ny < 0 || ny >= CHUNK_HEIGHT) continue;
+                            const int nx = wx + kDx[d];
+                            const int nz = wz + kDz[d];
+                            if (opaque(grid.block(nx, ny, nz)) && grid.find(nx, nz)) continue;
+                            // Light moving from the neighbour into this cell goes up if the neighbour is below
+                            const int decay = kDy[d] == -1 ? 1 : 2;
+                            best = std::max(best, value(nx, ny, nz) - decay);
+                        }
+                        if (best > out[i]) {
+                            out[i] = static_cast<std::uint8_t>(best);
+                            changed = true;
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return light;
+}
+
+// Full relight of a copy of the grid, as if every chunk had just loaded
+Grid relight_from_scratch(const Grid& grid, double* ms) {
+    Grid copy = grid;
+    voxel::SkylightPropagator full(copy);
+    const auto t0 = Clock::now();
+    full.chunks_loaded(copy.loaded());
+    *ms = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    return copy;
+}
+
+// First differing cell between two grids, or false if identical
+bool find_difference(const Grid& a, const Grid& b, ChunkKey* key, std::size_t* index) {
+    for (const auto& [k, c] : a.chunks) {
+        if (!c.loaded) continue;
+        const GridChunk& other = b.chunks.at(k);
+        if (c.light == other.light) continue;
+        for (std::size_t i = 0; i < static_cast<std::size_t>(CHUNK_SIZE); ++i) {
+            if (c.light.get(i) != other.light.get(i)) {
+                *key = k;
+                *index = i;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void report_cell(const char* what, const ChunkKey& key, std::size_t index, int got, int want) {
+    const int lx = static_cast<int>(index % CHUNK_WIDTH);
+    const int lz = static_cast<int>((index / CHUNK_WIDTH) % CHUNK_DEPTH);
+    const int y = static_cast<int>(index / (CHUNK_WIDTH * CHUNK_DEPTH));
+    std::fprintf(stderr, "%s: cell (%d, %d, %d) has %d, expected %d\n", what, key.first * CHUNK_WIDTH + lx, y,
+                 key.second * CHUNK_DEPTH + lz, got, want);
+}
+
+// Every cell that changed must be covered by a reported chunk, changed
+// border cells by the matching border bit, and every section whose mesh
+// reads the cell (its own, plus the one across an edge row) by its section
+// bit. Returns false on a miss.
+bool changes_cover(const Grid& before, const Grid& after, const std::vector<voxel::SkylightChange>& changes) {
+    for (const auto& [key, c] : after.chunks) {
+        if (!c.loaded) continue;
+        const GridChunk& old = before.chunks.at(key);
+        if (!old.loaded || c.light == old.light) continue;
+
+        auto it = std::find_if(changes.begin(), changes.end(), [&key = key](const voxel::SkylightChange& ch) {
+            return ch.cx == key.first && ch.cz == key.second;
+        });
+        if (it == changes.end()) return false;
+
+        for (std::size_t i = 0; i < static_cast<std::size_t>(CHUNK_SIZE); ++i) {
+            if (c.light.get(i) == old.light.get(i)) continue;
+            const int lx = static_cast<int>(i % CHUNK_WIDTH);
+            const int lz = static_cast<int>((i / CHUNK_WIDTH) % CHUNK_DEPTH);
+            const int y = static_cast<int>(i / (CHUNK_WIDTH * CHUNK_DEPTH));
+            for (int section = 0; section < voxel::CHUNK_SECTIONS; ++section) {
+                const int base = section * voxel::CHUNK_SECTION_HEIGHT;
+                if (y >= base - 1 && y <= base + voxel::CHUNK_SECTION_HEIGHT && !(it->sections & (1u << section))) {
+                    return false;
+                }
+            }
+            if ((lx == 0 && !(it->borders & voxel::SkylightChange::NegX)) ||
+                (lx == CHUNK_WIDTH - 1 && !(it->borders & voxel::SkylightChange::PosX)) ||
+                (lz == 0 && !(it->borders & voxel::SkylightChange::NegZ)) ||
+                (lz == CHUNK_DEPTH - 1 && !(it->borders & voxel::SkylightChange::PosZ))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void print_usage(const char* progname) {
+    std::printf("Usage: %s [options]\n\n", progname);
+    std::printf("Options:\n");
+    std::printf("  --side <n>          Grid size in chunks per side (default: 3)\n");
+    std::printf("  --edits <n>         Random edits to apply (default: 400)\n");
+    std::printf("  --seed <n>          Random seed (default: 1)\n");
+    std::printf("  --solver-every <n>  Edits between fixed-point solver checks (default: 50)\n");
+}
+
+bool parse_args(int argc, char** argv, Args& args) {
+    for (int i = 1; i < argc; ++i) {
+        const char* arg = argv[i];
+        if (std::strcmp(arg, "--side") == 0 && i + 1 < argc) {
+            args.side = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--edits") == 0 && i + 1 < argc) {
+            args.edits = std::atoi(argv[++i]);
+        } else if (std::strcmp(arg, "--seed") == 0 && i + 1 < argc) {
+            args.seed = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(arg, "--solver-every") == 0 && i + 1 < argc) {
+            args.solverEvery = std::atoi(argv[++i]);
+        } else {
+            return false;
+        }
+    }
+    return args.side > 0 && args.edits >= 0 && args.solverEvery > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Args args;
+    if (!parse_args(argc, argv, args)) {
+        print_usage(argv[0]);
+        return 2;
+    }
+
+    Grid grid;
+    for (int cz = 0; cz < args.side; ++cz) {
+        for (int cx = 0; cx < args.side; ++cx) {
+            GridChunk& c = grid.chunks[{cx, cz}];
+            for (int y = 0; y < CHUNK_HEIGHT; ++y) {
+                for (int lz = 0; lz < CHUNK_DEPTH; ++lz) {
+                    for (int lx = 0; lx < CHUNK_WIDTH; ++lx) {
+                        c.blocks[chunk_index(lx, y, lz)] = static_cast<Block>(
+                            scene_block(cx * CHUNK_WIDTH + lx, y, cz * CHUNK_DEPTH + lz));
+                    }
+                }
+            }
+            c.update_height();
+        }
+    }
+
+    voxel::SkylightPropagator propagator(grid);
+    const auto t0 = Clock::now();
+    propagator.chunks_loaded(grid.loaded());
+    const double initialMs = std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+    propagator.take_changes();
+
+    static const BlockType kPalette[] = {BlockType::Air, BlockType::Air, BlockType::Stone, BlockType::Dirt,
+                                         BlockType::Leaves, BlockType::Water, BlockType::StoneSlab};
+    std::mt19937 rng(args.seed);
+
+    std::size_t incrementalCells = 0;
+    std::size_t fullCells = 0;
+    double incrementalMs = 0.0;
+    double fullMs = 0.0;
+    int blockEdits = 0;
+    int chunkEdits = 0;
+    int solverChecks = 0;
+    std::size_t failures = 0;
+
+    for (int edit = 0; edit < args.edits && failures == 0; ++edit) {
+        const Grid before = grid;
+        const auto e0 = Clock::now();
+
+        // Mostly block edits; now and then unload a chunk or reload one
+        const std::vector<ChunkKey> loaded = grid.loaded();
+        const int kind = static_cast<int>(rng() % 20);
+        if (kind == 0 && loaded.size() > 1) {
+            const ChunkKey key = loaded[rng() % loaded.size()];
+            grid.chunks[key].loaded = false;
+            propagator.chunk_unloaded(key.first, key.second);
+            ++chunkEdits;
+        } else if (kind == 1 && loaded.size() < grid.chunks.size()) {
+            for (auto& [key, c] : grid.chunks) {
+                if (c.loaded) continue;
+                c.loaded = true;
+                propagator.chunks_loaded({key});
+                break;
+            }
+            ++chunkEdits;
+        } else {
+            // Half the edits land on a chunk border column; some above the
+            // scene so chunk heights grow and shrink by whole sections
+            const ChunkKey key = loaded[rng() % loaded.size()];
+            int lx = static_cast<int>(rng() % CHUNK_WIDTH);
+            const int lz = static_cast<int>(rng() % CHUNK_DEPTH);
+            if (rng() & 1u) lx = (rng() & 1u) ? CHUNK_WIDTH - 1 : 0;
+            const int y = 52 + static_cast<int>(rng() % 40);
+
+            GridChunk& c = grid.chunks[key];
+            Block& cell = c.blocks[chunk_index(lx, y, lz)];
+            const Block old = cell;
+            cell = static_cast<Block>(kPalette[rng() % std::size(kPalette)]);
+            c.update_height();
+            propagator.block_changed(key.first * CHUNK_WIDTH + lx, y, key.second * CHUNK_DEPTH + lz, old);
+            ++blockEdits;
+        }
+        incrementalMs += std::chrono::duration<double, std::milli>(Clock::now() - e0).count();
+        incrementalCells += propagator.cells_visited();
+
+        if (!changes_cover(before, grid, propagator.take_changes())) {
+            std::fprintf(stderr, "edit %d: a chunk whose light changed was not reported\n", edit);
+            ++failures;
+        }
+
+        double ms = 0.0;
+        const Grid full = relight_from_scratch(grid, &ms);
+        fullMs += ms;
+        fullCells += static_cast<std::size_t>(full.loaded().size()) * CHUNK_SIZE;
+
+        ChunkKey key;
+        std::size_t index = 0;
+        if (find_difference(grid, full, &key, &index)) {
+            report_cell("incremental vs full relight", key, index, grid.chunks.at(key).light.get(index),
+                        full.chunks.at(key).light.get(index));
+            ++failures;
+        }
+
+        if ((edit + 1) % args.solverEvery == 0 || edit + 1 == args.edits) {
+            ++solverChecks;
+            for (const auto& [k, want] : solve_fixed_point(grid)) {
+                const GridChunk& c = grid.chunks.at(k);
+                for (std::size_t i = 0; i < want.size(); ++i) {
+                    if (c.light.get(i) != want[i]) {
+                        report_cell("incremental vs fixed-point solver", k, i, c.light.get(i), want[i]);
+                        ++failures;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    const int steps = std::max(blockEdits + chunkEdits, 1);
+    std::printf("%dx%d chunks, initial light %.2f ms\n", args.side, args.side, initialMs);
+    std::printf("  %d block edits, %d chunk loads/unloads, %d solver checks\n", blockEdits, chunkEdits,
+                solverChecks);
+    std::printf("  incremental:   %8.3f ms/edit, %8.0f cells written/edit\n", incrementalMs / steps,
+                static_cast<double>(incrementalCells) / steps);
+    std::printf("  full relight:  %8.3f ms/edit, %8.0f cells/edit (%.0fx the time)\n", fullMs / steps,
+                static_cast<double>(fullCells) / steps, incrementalMs > 0.0 ? fullMs / incrementalMs : 0.0);
+
+    if (failures > 0) {
+        std::fprintf(stderr, "FAIL: incremental skylight diverged\n");
+        return 1;
+    }
+    std::printf("  incremental light matches full relight and fixed-point solver after every check\n");
+    return 0;
+}
@@ -0,0 +1,158 @@
+// =============================================================================
+// SpatialGrid benchmark
+// Per-tick item pickup queries for 32 players against 10k dropped items,
+// comparing a linear scan over every item with engine::SpatialGrid. Items are
+// spread over a 256x256 block arena with a share piled up at generators, and
+// some churn (spawns/despawns) runs every tick like a live match.
+//
+// Usage: bedwars_spatial_grid_bench [items] [players] [ticks]
+// =============================================================================
+
+#include <engine/core/spatial_grid.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr float kArenaSize = 256.0f;
+constexpr float kPickupRadius = 1.5f;
+constexpr std::size_t kChurnPerTick = 20;
+
+struct Item {
+    std::uint32_t id;
+    float x, y, z;
+};
+
+struct Player {
+    float x, y, z;
+    float vx, vz;
+};
+
+double us_since(Clock::time_point t0) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+}
+
+Item random_item(std::mt19937& rng, std::uint32_t id) {
+    std::uniform_real_distribution<float> pos(0.0f, kArenaSize);
+    std::uniform_int_distribution<int> pile(0, 3);
+    if (pile(rng) == 0) {
+        // Generator pile: a handful of fixed spots
+        const float gx = 32.0f + 64.0f * static_cast<float>(id % 4);
+        const float gz = 32.0f + 64.0f * static_cast<float>((id / 4) % 4);
+        return {id, gx, 65.0f, gz};
+    }
+    return {id, pos(rng), 65.0f, pos(rng)};
+}
+
+void step_players(std::vector<Player>& players) {
+    for (auto& p : players) {
+        p.x += p.vx;
+        p.z += p.vz;
+        if (p.x < 0.0f || p.x > kArenaSize) p.vx = -p.vx;
+        if (p.z < 0.0f || p.z > kArenaSize) p.vz = -p.vz;
+    }
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t itemCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000;
+    const std::size_t playerCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 32;
+    const std::size_t ticks = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 1000;
+
+    std::mt19937 rng(1337);
+    std::vector<Item> items;
+    items.reserve(itemCount);
+    for (std::uint32_t i = 0; i < itemCount; ++i) {
+        items.push_back(random_item(rng, i));
+    }
+
+    std::uniform_real_distribution<float> pos(0.0f, kArenaSize);
+    std::uniform_real_distribution<float> vel(-0.25f, 0.25f);
+    std::vector<Player> startPlayers(playerCount);
+    for (auto& p : startPlayers) {
+        p = {pos(rng), 65.0f, pos(rng), vel(rng), vel(rng)};
+    }
+
+    // Same churn sequence for both runs: slot to respawn, new item id
+    std::vector<std::size_t> churnSlots(ticks * kChurnPerTick);
+    std::uniform_int_distribution<std::size_t> slot(0, itemCount - 1);
+    for (auto& s : churnSlots) s = slot(rng);
+
+    const float r2 = kPickupRadius * kPickupRadius;
+
+    // ---- Linear scan -------------------------------------------------------
+    std::size_t scanHits = 0;
+    double scanUs = 0.0;
+    {
+        auto players = startPlayers;
+        auto live = items;
+        std::uint32_t nextId = static_cast<std::uint32_t>(itemCount);
+        std::mt19937 churnRng(7);
+        for (std::size_t t = 0; t < ticks; ++t) {
+            const auto t0 = Clock::now();
+            for (std::size_t c = 0; c < kChurnPerTick; ++c) {
+                live[churnSlots[t * kChurnPerTick + c]] = random_item(churnRng, nextId++);
+            }
+            for (const auto& p : players) {
+                for (const auto& item : live) {
+                    const float dx = item.x - p.x;
+                    const float dy = item.y - p.y;
+                    const float dz = item.z - p.z;
+                    if (dx * dx + dy * dy + dz * dz <= r2) ++scanHits;
+                }
+            }
+            scanUs += us_since(t0);
+            step_players(players);
+        }
+    }
+
+    // ---- SpatialGrid -------------------------------------------------------
+    std::size_t gridHits = 0;
+    double gridUs = 0.0;
+    {
+        auto players = startPlayers;
+        auto live = items;
+        engine::SpatialGrid grid(4.0f);
+        for (const auto& item : live) {
+            grid.insert(item.id, item.x, item.y, item.z);
+        }
+
+        std::vector<engine::SpatialGrid::Id> nearby;
+        std::uint32_t nextId = static_cast<std::uint32_t>(itemCount);
+        std::mt19937 churnRng(7);
+        for (std::size_t t = 0; t < ticks; ++t) {
+            const auto t0 = Clock::now();
+            for (std::size_t c = 0; c < kChurnPerTick; ++c) {
+                auto& item = live[churnSlots[t * kChurnPerTick + c]];
+                grid.remove(item.id);
+                item = random_item(churnRng, nextId++);
+                grid.insert(item.id, item.x, item.y, item.z);
+            }
+            for (const auto& p : players) {
+                grid.query_radius(p.x, p.y, p.z, kPickupRadius, nearby);
+                gridHits += nearby.size();
+            }
+            gridUs += us_since(t0);
+            step_players(players);
+        }
+    }
+
+    const double n = static_cast<double>(ticks);
+    std::printf("%zu items, %zu players, %zu ticks (%zu spawn/despawn per tick)\n",
+                itemCount, playerCount, ticks, kChurnPerTick);
+    std::printf("  linear scan   %9.1f us/tick  hits %zu\n", scanUs / n, scanHits);
+    std::printf("  spatial grid  %9.1f us/tick  hits %zu  (%.1fx)\n",
+                gridUs / n, gridHits, gridUs > 0.0 ? scanUs / gridUs : 0.0);
+    if (scanHits != gridHits) {
+        std::fprintf(stderr, "hit count mismatch\n");
+        return 1;
+    }
+    return 0;
+}
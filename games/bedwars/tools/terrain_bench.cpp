@@ -0,0 +1,172 @@
+// =============================================================================
+// Terrain override storage micro-benchmark
+// Compares the chunked BlockOverrides store used by Terrain against the
+// per-block hash maps it replaced, for get_block / place / break workloads.
+//
+// Usage: bedwars_terrain_bench [edits] [lookups]
+// =============================================================================
+
+#include "server/voxel/block_overrides.hpp"
+#include "server/voxel/terrain.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+using shared::voxel::BlockType;
+using Clock = std::chrono::steady_clock;
+
+// Previous Terrain storage: one heap node per edited block.
+struct HashOverrides {
+    struct Key {
+        int x, y, z;
+        bool operator==(const Key& o) const { return x == o.x && y == o.y && z == o.z; }
+    };
+    struct KeyHash {
+        std::size_t operator()(const Key& k) const {
+            std::size_t h = 1469598103934665603ull;
+            h ^= static_cast<std::size_t>(k.x) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            h ^= static_cast<std::size_t>(k.y) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            h ^= static_cast<std::size_t>(k.z) + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
+    bool find_type(int x, int y, int z, BlockType* out) const {
+        if (types.empty()) return false;
+        const auto it = types.find(Key{x, y, z});
+        if (it == types.end()) return false;
+        *out = it->second;
+        return true;
+    }
+    void place(int x, int y, int z, BlockType t) {
+        placed.insert(Key{x, y, z});
+        types[Key{x, y, z}] = t;
+    }
+    void break_block(int x, int y, int z) {
+        placed.erase(Key{x, y, z});
+        types[Key{x, y, z}] = BlockType::Air;
+    }
+
+    std::unordered_map<Key, BlockType, KeyHash> types;
+    std::unordered_set<Key, KeyHash> placed;
+};
+
+struct ChunkedOverrides {
+    bool find_type(int x, int y, int z, BlockType* out) const { return store.find_type(x, y, z, out); }
+    void place(int x, int y, int z, BlockType t) {
+        store.set_player_placed(x, y, z, true);
+        store.set_type(x, y, z, t);
+    }
+    void break_block(int x, int y, int z) {
+        store.set_player_placed(x, y, z, false);
+        store.set_type(x, y, z, BlockType::Air);
+    }
+
+    bedwars::voxel::BlockOverrides store;
+};
+
+struct Pos { int x, y, z; };
+
+// Edits cluster around a few bases/bridges on a ~12x12 chunk map, like a late-game match.
+std::vector<Pos> make_edit_positions(std::size_t count, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> xz(-96, 95);
+    std::uniform_int_distribution<int> y(40, 90);
+    std::vector<Pos> out;
+    out.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        out.push_back({xz(rng), y(rng), xz(rng)});
+    }
+    return out;
+}
+
+// Lookups are mostly misses (physics probes around players), mixed with hits.
+std::vector<Pos> make_lookup_positions(const std::vector<Pos>& edits, std::size_t count, std::uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> xz(-128, 127);
+    std::uniform_int_distribution<int> y(0, 255);
+    std::uniform_int_distribution<std::size_t> pick(0, edits.empty() ? 0 : edits.size() - 1);
+    std::vector<Pos> out;
+    out.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (!edits.empty() && (i & 3) == 0) {
+            out.push_back(edits[pick(rng)]);
+        } else {
+            out.push_back({xz(rng), y(rng), xz(rng)});
+        }
+    }
+    return out;
+}
+
+double ns_per_op(Clock::duration d, std::size_t ops) {
+    return ops == 0 ? 0.0 : static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count()) /
+                            static_cast<double>(ops);
+}
+
+template <typename Store>
+void run(const char* name, const std::vector<Pos>& edits, const std::vector<Pos>& lookups) {
+    Store store;
+
+    auto t0 = Clock::now();
+    for (const auto& p : edits) store.place(p.x, p.y, p.z, BlockType::TeamRed);
+    auto t1 = Clock::now();
+
+    std::size_t hits = 0;
+    BlockType out{};
+    for (const auto& p : lookups) {
+        if (store.find_type(p.x, p.y, p.z, &out)) ++hits;
+    }
+    auto t2 = Clock::now();
+
+    for (const auto& p : edits) store.break_block(p.x, p.y, p.z);
+    auto t3 = Clock::now();
+
+    std::printf("%-10s place %7.1f ns/op   get_block %6.1f ns/op   break %7.1f ns/op   (hits %zu)\n",
+                name, ns_per_op(t1 - t0, edits.size()), ns_per_op(t2 - t1, lookups.size()),
+                ns_per_op(t3 - t2, edits.size()), hits);
+}
+
+void run_terrain(const std::vector<Pos>& edits, const std::vector<Pos>& lookups) {
+    bedwars::voxel::Terrain terrain(1234);
+    terrain.set_void_base(true);
+
+    auto t0 = Clock::now();
+    for (const auto& p : edits) terrain.place_player_block(p.x, p.y, p.z, BlockType::TeamRed);
+    auto t1 = Clock::now();
+
+    std::size_t solid = 0;
+    for (const auto& p : lookups) {
+        if (terrain.get_block(p.x, p.y, p.z) != BlockType::Air) ++solid;
+    }
+    auto t2 = Clock::now();
+
+    for (const auto& p : edits) terrain.break_player_block(p.x, p.y, p.z);
+    auto t3 = Clock::now();
+
+    std::printf("%-10s place %7.1f ns/op   get_block %6.1f ns/op   break %7.1f ns/op   (solid %zu)\n",
+                "Terrain", ns_per_op(t1 - t0, edits.size()), ns_per_op(t2 - t1, lookups.size()),
+                ns_per_op(t3 - t2, edits.size()), solid);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const std::size_t editCount = argc > 1 ? static_cast<std::size_t>(std::strtoull(argv[1], nullptr, 10)) : 50'000;
+    const std::size_t lookupCount = argc > 2 ? static_cast<std::size_t>(std::strtoull(argv[2], nullptr, 10)) : 5'000'000;
+
+    const auto edits = make_edit_positions(editCount, 42);
+    const auto lookups = make_lookup_positions(edits, lookupCount, 7);
+
+    std::printf("Terrain override storage: %zu edits, %zu lookups\n", editCount, lookupCount);
+    run<HashOverrides>("hash", edits, lookups);
+    run<ChunkedOverrides>("chunked", edits, lookups);
+    run_terrain(edits, lookups);
+    return 0;
+}